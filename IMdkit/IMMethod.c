@@ -63,3 +63,19 @@ int IMSyncXlib(XIMS ims, XPointer call_data)
     ims->sync = True;
     return (ims->methods->syncXlib) (ims, call_data);
 }
+
+/* Milliseconds until IMExpireWaits() has work to do, a reply the server
+   waits for being overdue or output to retry, 0 if it has already, -1
+   if there is nothing to wait for. */
+long IMWaitTimeout (XIMS ims)
+{
+    return (ims->methods->waitTimeout) (ims);
+}
+
+/* Gives up on the overdue replies and retries the output clients did
+   not take, the main loop of the server calls it when IMWaitTimeout()
+   runs out. */
+void IMExpireWaits (XIMS ims)
+{
+    (ims->methods->expireWaits) (ims);
+}
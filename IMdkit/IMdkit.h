@@ -103,6 +103,8 @@ typedef struct
     int		(*preeditStart) (XIMS, XPointer);
     int		(*preeditEnd) (XIMS, XPointer);
     int		(*syncXlib) (XIMS, XPointer);
+    long	(*waitTimeout) (XIMS);
+    void	(*expireWaits) (XIMS);
 } IMMethodsRec, *IMMethods;
 
 typedef struct
@@ -132,5 +134,9 @@ int IMCallCallback (XIMS, XPointer);
 int IMPreeditStart (XIMS, XPointer);
 int IMPreeditEnd (XIMS, XPointer);
 int IMSyncXlib (XIMS, XPointer);
+long IMWaitTimeout (XIMS);
+void IMExpireWaits (XIMS);
+int IMUtf8ToCompoundText (const char *, int, char *, int);
+int IMCompoundTextToUtf8 (const char *, int, char *, int);
 
 #endif /* IMdkit_h */
@@ -75,10 +75,24 @@ typedef struct
     Bool        (*checkAddr) ();
 } TransportSW;
 
+/* Messages received while a client has to answer XIM_SYNC_REPLY are kept
+   in a ring of XIM_PENDING_MAX slots. Key presses which repeat one of the
+   last queued events are dropped once XIM_PENDING_COALESCE slots are used,
+   and every key press is dropped when only XIM_PENDING_RESERVE slots are
+   left, which are kept for the releases of the presses already queued. */
+#define XIM_PENDING_MAX		64
+#define XIM_PENDING_COALESCE	(XIM_PENDING_MAX * 3 / 4)
+#define XIM_PENDING_RESERVE	8
+#define XIM_PENDING_MSG_SIZE	64	/* largest message which is queued */
+
+/* how long a client may take to answer a request the server waits for */
+#define XIM_WAIT_TIMEOUT	2000	/* milliseconds */
+#define XIM_RETRY_INTERVAL	20	/* ms between writes to a full socket */
+
 typedef struct _XIMPending
 {
-    unsigned    char *p;
-    struct _XIMPending *next;
+    unsigned char p[XIM_PENDING_MSG_SIZE]; /* copy of the message */
+    unsigned long time;		/* when it was queued, in milliseconds */
 } XIMPending;
 
 typedef struct _XimProtoHdr
@@ -88,20 +102,53 @@ typedef struct _XimProtoHdr
     CARD16	length;
 } XimProtoHdr;
 
+/* same layout as XICAttr, both lists are made by CreateAttrList */
 typedef struct
 {
-    CARD16	attribute_id;
+    CARD16	attribute_id;	/* index in xim_attr */
     CARD16	type;
     CARD16	length;
     char	*name;
+    CARD16	kind;		/* always XimAttr_Unknown */
 } XIMAttr;
 
-typedef struct
-{
-    CARD16	attribute_id;
+/* IC attributes we know, resolved from their names once in
+   _Xi18nInitAttrList so that the server can switch on them */
+typedef enum
+{
+    XimAttr_Unknown = 0,
+    XimAttr_InputStyle,
+    XimAttr_ClientWindow,
+    XimAttr_FocusWindow,
+    XimAttr_FilterEvents,
+    XimAttr_PreeditAttributes,
+    XimAttr_StatusAttributes,
+    XimAttr_FontSet,
+    XimAttr_Area,
+    XimAttr_AreaNeeded,
+    XimAttr_Colormap,
+    XimAttr_StdColormap,
+    XimAttr_Foreground,
+    XimAttr_Background,
+    XimAttr_BackgroundPixmap,
+    XimAttr_SpotLocation,
+    XimAttr_LineSpace,
+    XimAttr_PreeditState,
+    XimAttr_PreeditStartCallback,
+    XimAttr_PreeditDoneCallback,
+    XimAttr_PreeditDrawCallback,
+    XimAttr_StringConversionCallback,
+    XimAttr_StringConversion,
+    XimAttr_SeparatorofNestedList
+} XimAttrKind;
+
+typedef struct
+{
+    CARD16	attribute_id;	/* index in xic_attr */
     CARD16	type;
     CARD16	length;
     char	*name;
+    CARD16	kind;		/* XimAttrKind */
 } XICAttr;
 
 typedef struct
@@ -118,10 +165,18 @@ typedef struct
 {
     int		attribute_id;
     CARD16	name_length;
-    char	*name;
+    char	*name;		/* points to the name in xic_attr */
     int		value_length;
-    void	*value;
+    void	*value;		/* &small for the values that fit there,
+				   otherwise malloc()ed */
     int		type;
+    int		kind;		/* XimAttrKind */
+    union
+    {
+        CARD32		card;
+        XPoint		point;
+        XRectangle	rect;
+    } small;
 } XICAttribute;
 
 typedef struct
@@ -148,8 +203,22 @@ typedef struct _Xi18nClient
        'l': for little-endian
      */
     int		sync;
-    XIMPending  *pending;
+    XIMPending  *pending;	/* ring of XIM_PENDING_MAX, allocated on use */
+    int		pending_head;
+    int		pending_count;
+    unsigned char dropped_keys[32]; /* keycodes whose press was dropped */
+    int		waiting;	/* a reply is expected, see _Xi18nWaitReply */
+    CARD8	wait_major;
+    CARD8	wait_minor;
+    unsigned long wait_deadline;
+    struct _Xi18nClient *wait_next; /* in waiting_clients */
+    unsigned long stalls;	/* replies which did not come in time */
+    int		ext_forward;	/* asked for XIM_EXT_FORWARD_KEYEVENT */
+    int		utf8;		/* negotiated UTF8_STRING, not COMPOUND_TEXT */
+    unsigned char *out_buf;	/* outgoing message, header and body */
+    int		out_buf_size;
     void *trans_rec;		/* contains transport specific data  */
+    struct _Xi18nMethodsRec *methods; /* transport this client came in on */
     struct _Xi18nClient *next;
 } Xi18nClient;
 
@@ -443,6 +512,23 @@ typedef int (*IMProtoHandler) (XIMS, IMProtocol*);
 
 #define DEFAULT_FILTER_MASK	(KeyPressMask)
 
+/* transport statistics */
+typedef struct _Xi18nStats
+{
+    unsigned long messages;	/* messages sent */
+    unsigned long packets;	/* ClientMessages or writes carrying them */
+    unsigned long flushes;	/* output flushes */
+    int		queue_depth;	/* messages waiting for the next flush */
+    int		max_queue_depth;
+    int		max_pending;	/* high-water mark of a client sync queue */
+    unsigned long pending_processed;
+    unsigned long pending_dropped;
+    unsigned long pending_latency; /* total ms spent in sync queues */
+    unsigned long max_pending_latency;
+    unsigned long waits;	/* replies waited for */
+    unsigned long wait_stalls;	/* waits which timed out */
+} Xi18nStats;
+
 /* Xi18nAddressRec structure */
 typedef struct _Xi18nAddressRec
 {
@@ -464,6 +550,7 @@ typedef struct _Xi18nAddressRec
     Atom	selection;
     Atom	Localename;
     Atom	Transportname;
+    Atom	XIM_Servers;	/* interned on the display of this core */
     /* XIM/XIC Attr */
     int		im_attr_num;
     XIMAttr	*xim_attr;
@@ -481,9 +568,22 @@ typedef struct _Xi18nAddressRec
        XSpecRec in Xi18nX.h for X-based connection.
        TransSpecRec in Xi18nTr.h for Socket-based connection.
      */
+    /* local/ transport address, when it runs alongside X/ */
+    void	*trans_addr;
     /* clients table */
     Xi18nClient *clients;
     Xi18nClient *free_clients;
+    Xi18nClient **client_table;	/* indexed by connect_id */
+    int		client_table_size;
+    CARD16	last_connect_id; /* of this core, a display has its own */
+    /* outgoing messages are not flushed while cork > 0 */
+    int		cork;
+    /* clients whose output did not fit in their socket, the next flush
+       tries again */
+    int		blocked_clients;
+    /* clients which owe a reply, the earliest deadline first */
+    Xi18nClient *waiting_clients;
+    Xi18nStats	stats;
 } Xi18nAddressRec;
 
 typedef struct _Xi18nMethodsRec
@@ -493,12 +593,14 @@ typedef struct _Xi18nMethodsRec
     Bool (*send) (XIMS, CARD16, unsigned char*, long);
     Bool (*wait) (XIMS, CARD16, CARD8, CARD8);
     Bool (*disconnect) (XIMS, CARD16);
+    Bool (*flush) (XIMS);
 } Xi18nMethodsRec;
 
 typedef struct _Xi18nCore
 {
     Xi18nAddressRec address;
     Xi18nMethodsRec methods;
+    Xi18nMethodsRec trans_methods;	/* local/ transport */
 } Xi18nCore;
 
 #endif
@@ -0,0 +1,55 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifndef _Xi18nTr_h
+#define _Xi18nTr_h
+
+/* default directory for local/ sockets, same as the one Xtrans uses
+   on the client side */
+#define XIM_LOCAL_DIR		"/tmp/.XIM-unix"
+
+/* initial size of the per-client receive buffer */
+#define TRANS_READ_BUFSIZE	1024
+
+typedef struct _TransClient
+{
+    int		fd;		/* connected socket */
+    unsigned char *buf;		/* bytes received but not yet dispatched */
+    int		buf_len;
+    int		buf_size;
+    unsigned char *out;		/* bytes queued until the next flush */
+    int		out_len;
+    int		out_size;
+    int		blocked;	/* the socket did not take all of out */
+    CARD16	connect_id;
+    int		dirty;		/* on the dirty list of TransSpecRec */
+    struct _TransClient *dirty_next;
+} TransClient;
+
+typedef struct
+{
+    int		fd;		/* listening socket */
+    char	*path;		/* socket file name */
+    struct _Xi18nClient **fd_table; /* clients indexed by their socket */
+    int		fd_table_size;
+    /* clients with queued output, so a flush does not look at the
+       others */
+    TransClient	*dirty;
+} TransSpecRec;
+
+#endif
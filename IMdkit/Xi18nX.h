@@ -32,21 +32,49 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #ifndef _Xi18nTrX_h
 #define _Xi18nTrX_h
 
+#include <X11/Xutil.h>
+
 #define _XIM_PROTOCOL           "_XIM_PROTOCOL"
 #define _XIM_XCONNECT           "_XIM_XCONNECT"
 
 #define XCM_DATA_LIMIT		20
 
+/* number of property atoms each client cycles through for messages
+   longer than XCM_DATA_LIMIT */
+#define XCM_PROPERTY_ATOMS	22
+
 typedef struct _XClient
 {
     Window	client_win;	/* client window */
     Window	accept_win;	/* accept window */
+    Atom	atoms[XCM_PROPERTY_ATOMS]; /* interned at connect time */
+    int		atom_index;	/* next atom to use */
 } XClient;
 
 typedef struct
 {
     Atom	xim_request;
     Atom	connect_request;
+    XContext	client_context;	/* accept_win -> Xi18nClient */
 } XSpecRec;
 
+#ifdef USE_XCB
+#include <xcb/xcb.h>
+
+/* number of already queued messages of a client whose properties are
+   requested together, before waiting for the first reply */
+#define XCB_READ_AHEAD		16
+
+/* the X transport of i18nXcb.c, same as XClient otherwise */
+typedef struct _XcbClient
+{
+    xcb_window_t client_win;	/* client window */
+    xcb_window_t accept_win;	/* accept window */
+    xcb_atom_t	atoms[XCM_PROPERTY_ATOMS];
+    xcb_intern_atom_cookie_t atom_cookies[XCM_PROPERTY_ATOMS];
+    Bool	atoms_pending;	/* replies of atom_cookies not read yet */
+    int		atom_index;	/* next atom to use */
+} XcbClient;
+#endif
+
 #endif
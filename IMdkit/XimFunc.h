@@ -47,6 +47,46 @@ int _Xi18nStatusDrawCallback (XIMS ims, IMProtocol *call_data);
 int _Xi18nStatusDoneCallback (XIMS ims, IMProtocol *call_data);
 int _Xi18nStringConversionCallback (XIMS ims, IMProtocol *call_data);
 
+/* i18nCodec.c */
+int _Xi18nEncodeForwardEvent (unsigned char *buf, Bool swap,
+                              CARD16 connect_id, CARD16 icid,
+                              CARD16 flag, CARD16 serial);
+int _Xi18nDecodeForwardEvent (unsigned char *p, Bool swap,
+                              CARD16 *connect_id, CARD16 *icid,
+                              CARD16 *flag, CARD16 *serial);
+int _Xi18nEncodeExtForwardKeyEvent (unsigned char *buf, Bool swap,
+                                    CARD16 connect_id, CARD16 icid,
+                                    CARD16 flag, CARD16 serial,
+                                    CARD8 type, CARD8 keycode, CARD16 state,
+                                    CARD32 time, CARD32 window);
+int _Xi18nCommitCharsSize (int length);
+int _Xi18nEncodeCommitChars (unsigned char *buf, Bool swap,
+                             CARD16 connect_id, CARD16 icid, CARD16 flag,
+                             const char *str, CARD16 length);
+int _Xi18nPreeditDrawSize (int length, int feedback_count);
+int _Xi18nEncodePreeditDraw (unsigned char *buf, Bool swap,
+                             CARD16 connect_id, CARD16 icid,
+                             CARD32 caret, CARD32 chg_first,
+                             CARD32 chg_length, CARD32 status,
+                             const char *str, CARD16 length,
+                             const XIMFeedback *feedback, int feedback_count);
+int _Xi18nDecodeCreateIC (unsigned char *p, Bool swap,
+                          CARD16 *connect_id, CARD16 *byte_length);
+int _Xi18nDecodeSetICValues (unsigned char *p, Bool swap,
+                             CARD16 *connect_id, CARD16 *icid,
+                             CARD16 *byte_length);
+int _Xi18nDecodeICAttribute (unsigned char *p, Bool swap,
+                             CARD16 *attribute_id, CARD16 *value_length,
+                             unsigned char **value);
+int _Xi18nDecodeSyncReply (unsigned char *p, Bool swap,
+                           CARD16 *connect_id, CARD16 *icid);
+CARD16 _Xi18nDecodeCard16 (unsigned char *p, Bool swap);
+CARD32 _Xi18nDecodeCard32 (unsigned char *p, Bool swap);
+int _Xi18nDecodePoint (unsigned char *p, Bool swap, XPoint *point);
+int _Xi18nDecodeRectangle (unsigned char *p, Bool swap, XRectangle *rect);
+int _Xi18nEncodeICReply (unsigned char *buf, Bool swap,
+                         CARD16 connect_id, CARD16 icid);
+
 /* i18nIc.c */
 void _Xi18nChangeIC (XIMS ims, IMProtocol *call_data, unsigned char *p,
                      int create_flag);
@@ -61,6 +101,19 @@ void _Xi18nDeleteAllClients (Xi18n i18n_core);
 void _Xi18nDeleteFreeClients (Xi18n i18n_core);
 void _Xi18nSendMessage (XIMS ims, CARD16 connect_id, CARD8 major_opcode,
                         CARD8 minor_opcode, unsigned char *data, long length);
+unsigned char *_Xi18nReserveMessage (XIMS ims, CARD16 connect_id,
+                                     long length);
+void _Xi18nCommitMessage (XIMS ims, CARD16 connect_id, CARD8 major_opcode,
+                          CARD8 minor_opcode, long length);
+Bool _Xi18nWaitReply (XIMS ims, CARD16 connect_id, CARD8 major_opcode,
+                      CARD8 minor_opcode);
+void _Xi18nEndWait (Xi18n i18n_core, Xi18nClient *client);
+unsigned long _Xi18nTime (void);
+long _Xi18nWaitTimeout (XIMS ims);
+void _Xi18nExpireWaits (XIMS ims);
+void _Xi18nCork (XIMS ims);
+void _Xi18nUncork (XIMS ims);
+void _Xi18nFlush (XIMS ims);
 void _Xi18nSendTriggerKey (XIMS ims, CARD16 connect_id);
 void _Xi18nSetEventMask (XIMS ims, CARD16 connect_id, CARD16 im_id,
                          CARD16 ic_id, CARD32 forward_mask, CARD32 sync_mask);
@@ -70,5 +123,8 @@ void _XRegisterFilterByType(Display*, Window, int, int,
 		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
 void _XUnregisterFilter(Display*, Window, 
 		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
+Status _XRegisterInternalConnection(Display*, int,
+		void (*callback)(Display*, int, XPointer), XPointer);
+void _XUnregisterInternalConnection(Display*, int);
 
 #endif
@@ -30,7 +30,6 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 ******************************************************************/
 
 #include <X11/Xlib.h>
-#include <X11/Xresource.h>
 #include "IMdkit.h"
 #include "Xi18n.h"
 #include "XimFunc.h"
@@ -39,6 +38,7 @@ typedef struct
 {
     char *name;
     CARD16 type;
+    CARD16 kind;
 } IMListOfAttr;
 
 typedef struct
@@ -50,38 +50,39 @@ typedef struct
 
 IMListOfAttr Default_IMattr[] =
 {
-    {XNQueryInputStyle,   XimType_XIMStyles},
-    {XNQueryIMValuesList, XimType_XIMValuesList},
-    {XNQueryICValuesList, XimType_XIMValuesList},
-    {(char *) NULL, (CARD16) 0}
+    {XNQueryInputStyle,   XimType_XIMStyles,     XimAttr_Unknown},
+    {XNQueryIMValuesList, XimType_XIMValuesList, XimAttr_Unknown},
+    {XNQueryICValuesList, XimType_XIMValuesList, XimAttr_Unknown},
+    {(char *) NULL, (CARD16) 0, (CARD16) 0}
 };
 
 IMListOfAttr Default_ICattr[] =
 {
-    {XNInputStyle,              XimType_CARD32},
-    {XNClientWindow,            XimType_Window},
-    {XNFocusWindow,             XimType_Window},
-    {XNFilterEvents,            XimType_CARD32},
-    {XNPreeditAttributes,       XimType_NEST},
-    {XNStatusAttributes,        XimType_NEST},
-    {XNFontSet,                 XimType_XFontSet},
-    {XNArea,                    XimType_XRectangle},
-    {XNAreaNeeded,              XimType_XRectangle},
-    {XNColormap,                XimType_CARD32},
-    {XNStdColormap,             XimType_CARD32},
-    {XNForeground,              XimType_CARD32},
-    {XNBackground,              XimType_CARD32},
-    {XNBackgroundPixmap,        XimType_CARD32},
-    {XNSpotLocation,            XimType_XPoint},
-    {XNLineSpace,               XimType_CARD32},
-    {XNPreeditState,            XimType_CARD32},
-    {XNPreeditStartCallback,    XimType_CARD32},
-    {XNPreeditDoneCallback,     XimType_CARD32},
-    {XNPreeditDrawCallback,     XimType_CARD32},
-    {XNStringConversionCallback, XimType_CARD32},
-    {XNStringConversion,        XimType_CARD32},
-    {XNSeparatorofNestedList,   XimType_SeparatorOfNestedList},
-    {(char *) NULL, (CARD16) 0}
+    {XNInputStyle,              XimType_CARD32,     XimAttr_InputStyle},
+    {XNClientWindow,            XimType_Window,     XimAttr_ClientWindow},
+    {XNFocusWindow,             XimType_Window,     XimAttr_FocusWindow},
+    {XNFilterEvents,            XimType_CARD32,     XimAttr_FilterEvents},
+    {XNPreeditAttributes,       XimType_NEST,       XimAttr_PreeditAttributes},
+    {XNStatusAttributes,        XimType_NEST,       XimAttr_StatusAttributes},
+    {XNFontSet,                 XimType_XFontSet,   XimAttr_FontSet},
+    {XNArea,                    XimType_XRectangle, XimAttr_Area},
+    {XNAreaNeeded,              XimType_XRectangle, XimAttr_AreaNeeded},
+    {XNColormap,                XimType_CARD32,     XimAttr_Colormap},
+    {XNStdColormap,             XimType_CARD32,     XimAttr_StdColormap},
+    {XNForeground,              XimType_CARD32,     XimAttr_Foreground},
+    {XNBackground,              XimType_CARD32,     XimAttr_Background},
+    {XNBackgroundPixmap,        XimType_CARD32,     XimAttr_BackgroundPixmap},
+    {XNSpotLocation,            XimType_XPoint,     XimAttr_SpotLocation},
+    {XNLineSpace,               XimType_CARD32,     XimAttr_LineSpace},
+    {XNPreeditState,            XimType_CARD32,     XimAttr_PreeditState},
+    {XNPreeditStartCallback,    XimType_CARD32,     XimAttr_PreeditStartCallback},
+    {XNPreeditDoneCallback,     XimType_CARD32,     XimAttr_PreeditDoneCallback},
+    {XNPreeditDrawCallback,     XimType_CARD32,     XimAttr_PreeditDrawCallback},
+    {XNStringConversionCallback, XimType_CARD32,    XimAttr_StringConversionCallback},
+    {XNStringConversion,        XimType_CARD32,     XimAttr_StringConversion},
+    {XNSeparatorofNestedList,   XimType_SeparatorOfNestedList,
+                                                    XimAttr_SeparatorofNestedList},
+    {(char *) NULL, (CARD16) 0, (CARD16) 0}
 };
 
 IMExtList Default_Extension[] =
@@ -124,12 +125,15 @@ static XIMAttr *CreateAttrList (Xi18n i18n_core,
         p->name = attr->name;
         p->length = strlen (attr->name);
         p->type = (CARD16) attr->type;
-        p->attribute_id = XrmStringToQuark (p->name);
-        if (strcmp (p->name, XNPreeditAttributes) == 0)
+        p->kind = attr->kind;
+        /* the ids are ours to choose, so an id is the index in the list
+           and looking an attribute up does not need a search */
+        p->attribute_id = (CARD16) (p - args);
+        if (p->kind == XimAttr_PreeditAttributes)
             i18n_core->address.preeditAttr_id = p->attribute_id;
-        else if (strcmp (p->name, XNStatusAttributes) == 0)
+        else if (p->kind == XimAttr_StatusAttributes)
             i18n_core->address.statusAttr_id = p->attribute_id;
-        else if (strcmp (p->name, XNSeparatorofNestedList) == 0)
+        else if (p->kind == XimAttr_SeparatorofNestedList)
             i18n_core->address.separatorAttr_id = p->attribute_id;
         /*endif*/
     }
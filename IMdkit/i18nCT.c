@@ -0,0 +1,422 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+/*
+ * COMPOUND_TEXT codec for the texts of the clients which did not
+ * negotiate UTF8_STRING. It converts from and to UTF-8 directly, so
+ * it does not depend on the locale of the server nor on the Xlib
+ * converters.
+ *
+ * Like Xlib, the encoder keeps ISO8859-1 in GR and switches GL between
+ * ASCII and KSC5601 as needed, test/ct checks it gives the same bytes.
+ * Other characters go to a UTF-8 segment. The decoder understands what
+ * the encoder produces and the sets Xlib uses for Korean, anything else
+ * comes out as '?'.
+ *
+ * Both write into a caller supplied buffer like snprintf does: they
+ * return the length of the whole result, without the terminating NUL,
+ * and store at most size - 1 bytes of it followed by a NUL.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include "IMdkit.h"
+#include "ksc5601.h"
+
+#define CT_ESC		0x1B
+#define CT_CSI		0x9B
+
+/* c is evaluated once even when the buffer is full, it may be *p++ */
+#define PutByte(c) \
+    do { char c_ = (char) (c); if (n < size) buf[n] = c_; n++; } while (0)
+#define PutString(s, len) \
+    do { int k_, l_ = (len); \
+         for (k_ = 0;  k_ < l_;  k_++) PutByte ((s)[k_]); } while (0)
+
+static const char ct_ascii_gl[] = "\033(B";
+static const char ct_ksc5601_gl[] = "\033$(C";
+static const char ct_utf8_begin[] = "\033%G";
+static const char ct_utf8_end[] = "\033%@";
+
+static int KSC5601Compare (const void *x, const void *y)
+{
+    const KSC5601Pair *a = x;
+    const KSC5601Pair *b = y;
+
+    return (int) a->ucs - (int) b->ucs;
+}
+
+static int KSC5601FromUcs (unsigned long ucs)
+{
+    KSC5601Pair key;
+    KSC5601Pair *res;
+
+    if (ucs < ksc5601_from_ucs[0].ucs  ||  ucs > 0xFFFF)
+        return 0;
+    /*endif*/
+    key.ucs = (unsigned short) ucs;
+    res = bsearch (&key,
+                   ksc5601_from_ucs,
+                   sizeof (ksc5601_from_ucs) / sizeof (ksc5601_from_ucs[0]),
+                   sizeof (KSC5601Pair),
+                   KSC5601Compare);
+    return res != NULL ? res->code : 0;
+}
+
+static unsigned long KSC5601ToUcs (int c1, int c2)
+{
+    c1 &= 0x7F;
+    c2 &= 0x7F;
+    if (c1 < 0x21  ||  c1 > 0x7E  ||  c2 < 0x21  ||  c2 > 0x7E)
+        return 0;
+    /*endif*/
+    return ksc5601_to_ucs[(c1 - 0x21)*94 + (c2 - 0x21)];
+}
+
+/* Reads one character, returns the number of bytes it takes or 0 for
+   an invalid sequence. */
+static int Utf8GetChar (const unsigned char *p, int len, unsigned long *ucs)
+{
+    unsigned long c;
+    int i, n;
+
+    if (p[0] < 0x80)
+    {
+        *ucs = p[0];
+        return 1;
+    }
+    else if ((p[0] & 0xE0) == 0xC0)
+    {
+        c = p[0] & 0x1F;
+        n = 2;
+    }
+    else if ((p[0] & 0xF0) == 0xE0)
+    {
+        c = p[0] & 0x0F;
+        n = 3;
+    }
+    else if ((p[0] & 0xF8) == 0xF0)
+    {
+        c = p[0] & 0x07;
+        n = 4;
+    }
+    else
+    {
+        return 0;
+    }
+    /*endif*/
+    if (n > len)
+        return 0;
+    /*endif*/
+    for (i = 1;  i < n;  i++)
+    {
+        if ((p[i] & 0xC0) != 0x80)
+            return 0;
+        /*endif*/
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    /*endfor*/
+    *ucs = c;
+    return n;
+}
+
+static int Utf8PutChar (unsigned long ucs, unsigned char *p)
+{
+    if (ucs < 0x80)
+    {
+        p[0] = (unsigned char) ucs;
+        return 1;
+    }
+    else if (ucs < 0x800)
+    {
+        p[0] = 0xC0 | (unsigned char) (ucs >> 6);
+        p[1] = 0x80 | (unsigned char) (ucs & 0x3F);
+        return 2;
+    }
+    else if (ucs < 0x10000)
+    {
+        p[0] = 0xE0 | (unsigned char) (ucs >> 12);
+        p[1] = 0x80 | (unsigned char) ((ucs >> 6) & 0x3F);
+        p[2] = 0x80 | (unsigned char) (ucs & 0x3F);
+        return 3;
+    }
+    /*endif*/
+    p[0] = 0xF0 | (unsigned char) (ucs >> 18);
+    p[1] = 0x80 | (unsigned char) ((ucs >> 12) & 0x3F);
+    p[2] = 0x80 | (unsigned char) ((ucs >> 6) & 0x3F);
+    p[3] = 0x80 | (unsigned char) (ucs & 0x3F);
+    return 4;
+}
+
+static void Terminate (char *buf, int size, int n)
+{
+    if (size > 0)
+        buf[n < size ? n : size - 1] = '\0';
+    /*endif*/
+}
+
+int IMUtf8ToCompoundText (const char *utf8, int length, char *buf, int size)
+{
+    const unsigned char *p = (const unsigned char *) utf8;
+    const unsigned char *end;
+    Bool gl_ksc5601 = False;	/* GL starts as ASCII */
+    Bool in_utf8 = False;
+    unsigned long ucs;
+    int code = 0;
+    int n = 0;
+    int len;
+
+    if (length < 0)
+        length = strlen (utf8);
+    /*endif*/
+    end = p + length;
+    while (p < end)
+    {
+        len = Utf8GetChar (p, end - p, &ucs);
+        if (len == 0)
+        {
+            /* skip a broken byte */
+            p++;
+            continue;
+        }
+        /*endif*/
+
+        if (ucs >= 0x80  &&  (ucs < 0xA0  ||  ucs > 0xFF))
+        {
+            code = KSC5601FromUcs (ucs);
+            if (code == 0)
+            {
+                if (!in_utf8)
+                {
+                    PutString (ct_utf8_begin, 3);
+                    in_utf8 = True;
+                }
+                /*endif*/
+                PutString (p, len);
+                p += len;
+                continue;
+            }
+            /*endif*/
+        }
+        /*endif*/
+
+        if (in_utf8)
+        {
+            PutString (ct_utf8_end, 3);
+            in_utf8 = False;
+        }
+        /*endif*/
+        if (ucs < 0x80)
+        {
+            if (gl_ksc5601)
+            {
+                PutString (ct_ascii_gl, 3);
+                gl_ksc5601 = False;
+            }
+            /*endif*/
+            PutByte (ucs);
+        }
+        else if (ucs <= 0xFF)
+        {
+            PutByte (ucs);
+        }
+        else
+        {
+            if (!gl_ksc5601)
+            {
+                PutString (ct_ksc5601_gl, 4);
+                gl_ksc5601 = True;
+            }
+            /*endif*/
+            PutByte (code >> 8);
+            PutByte (code & 0xFF);
+        }
+        /*endif*/
+        p += len;
+    }
+    /*endwhile*/
+    if (in_utf8)
+        PutString (ct_utf8_end, 3);
+    /*endif*/
+
+    Terminate (buf, size, n);
+    return n;
+}
+
+/* what is designated to GL or GR */
+typedef enum
+{
+    CT_ASCII,
+    CT_LATIN1,
+    CT_KSC5601,
+    CT_UNKNOWN94,	/* a set we do not know, one byte per character */
+    CT_UNKNOWN94N	/* same, two bytes per character */
+} CTCharset;
+
+/* Parses an escape sequence at p, which starts with ESC, and updates
+   the state. Returns the number of bytes it takes. */
+static int ParseEscape (const unsigned char *p,
+                        const unsigned char *end,
+                        CTCharset *gl,
+                        CTCharset *gr,
+                        Bool *in_utf8)
+{
+    const unsigned char *q = p + 1;
+    int len;
+
+    /* intermediate bytes, then a final byte */
+    while (q < end  &&  *q >= 0x20  &&  *q <= 0x2F)
+        q++;
+    /*endwhile*/
+    if (q >= end)
+        return end - p;
+    /*endif*/
+    len = q - p + 1;
+
+    if (len == 3  &&  p[1] == '%')
+    {
+        if (*q == 'G')
+            *in_utf8 = True;
+        else if (*q == '@')
+            *in_utf8 = False;
+        /*endif*/
+    }
+    else if (len == 4  &&  p[1] == '%'  &&  p[2] == '/')
+    {
+        /* extended segment, M L is the length of what follows */
+        if (end - q > 2)
+            len += ((q[1] & 0x7F) << 7 | (q[2] & 0x7F)) + 2;
+        /*endif*/
+        if (len > end - p)
+            len = end - p;
+        /*endif*/
+    }
+    else if (len == 3  &&  p[1] == '(')
+    {
+        *gl = (*q == 'B'  ||  *q == 'J')  ?  CT_ASCII  :  CT_UNKNOWN94;
+    }
+    else if (len == 3  &&  (p[1] == ')'  ||  p[1] == '-'))
+    {
+        *gr = (p[1] == '-'  &&  *q == 'A')  ?  CT_LATIN1  :  CT_UNKNOWN94;
+    }
+    else if (len == 4  &&  p[1] == '$'  &&  p[2] == '(')
+    {
+        *gl = (*q == 'C')  ?  CT_KSC5601  :  CT_UNKNOWN94N;
+    }
+    else if (len == 4  &&  p[1] == '$'  &&  p[2] == ')')
+    {
+        *gr = (*q == 'C')  ?  CT_KSC5601  :  CT_UNKNOWN94N;
+    }
+    /*endif*/
+    return len;
+}
+
+int IMCompoundTextToUtf8 (const char *ct, int length, char *buf, int size)
+{
+    const unsigned char *p = (const unsigned char *) ct;
+    const unsigned char *end;
+    CTCharset gl = CT_ASCII;
+    CTCharset gr = CT_LATIN1;
+    CTCharset cs;
+    Bool in_utf8 = False;
+    unsigned char tmp[4];
+    unsigned long ucs;
+    int n = 0;
+
+    if (length < 0)
+        length = strlen (ct);
+    /*endif*/
+    end = p + length;
+    while (p < end)
+    {
+        if (*p == CT_ESC)
+        {
+            p += ParseEscape (p, end, &gl, &gr, &in_utf8);
+            continue;
+        }
+        /*endif*/
+        if (in_utf8)
+        {
+            PutByte (*p++);
+            continue;
+        }
+        /*endif*/
+        if (*p == CT_CSI)
+        {
+            /* direction, which we do not care */
+            p++;
+            while (p < end  &&  (*p < 0x40  ||  *p > 0x7E))
+                p++;
+            /*endwhile*/
+            p++;
+            continue;
+        }
+        /*endif*/
+
+        if (*p < 0x21  ||  *p == 0x7F)
+        {
+            /* controls and space are not affected by GL */
+            PutByte (*p++);
+            continue;
+        }
+        else if (*p >= 0x80  &&  *p < 0xA0)
+        {
+            p++;
+            continue;
+        }
+        /*endif*/
+
+        cs = (*p < 0x80)  ?  gl  :  gr;
+        switch (cs)
+        {
+        case CT_ASCII:
+            PutByte (*p++);
+            break;
+
+        case CT_LATIN1:
+            PutString (tmp, Utf8PutChar (*p++, tmp));
+            break;
+
+        case CT_KSC5601:
+            ucs = (end - p >= 2)  ?  KSC5601ToUcs (p[0], p[1])  :  0;
+            if (ucs != 0)
+                PutString (tmp, Utf8PutChar (ucs, tmp));
+            else
+                PutByte ('?');
+            /*endif*/
+            p += 2;
+            break;
+
+        case CT_UNKNOWN94N:
+            PutByte ('?');
+            p += 2;
+            break;
+
+        default:
+            PutByte ('?');
+            p++;
+            break;
+        }
+        /*endswitch*/
+    }
+    /*endwhile*/
+
+    Terminate (buf, size, n);
+    return n;
+}
@@ -121,10 +121,8 @@ int _Xi18nPreeditStartCallback (XIMS ims, IMProtocol *call_data)
 int _Xi18nPreeditDrawCallback (XIMS ims, IMProtocol *call_data)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    extern XimFrameRec preedit_draw_fr[];
     register int total_size;
-    unsigned char *reply = NULL;
+    unsigned char *reply;
     IMPreeditCBStruct *preedit_CB =
         (IMPreeditCBStruct *) &call_data->preedit_callback;
     XIMPreeditDrawCallbackStruct *draw =
@@ -140,51 +138,34 @@ int _Xi18nPreeditDrawCallback (XIMS ims, IMProtocol *call_data)
         status = 0x00000002;
     /*endif*/
 
-    fm = FrameMgrInit (preedit_draw_fr,
-                       NULL,
-                       _Xi18nNeedSwap (i18n_core, connect_id));
-
-    /* set length of preedit string */
-    FrameMgrSetSize (fm, draw->text->length);
-
     /* set iteration count for list of feedback */
     for (i = 0;  draw->text->feedback[i] != 0;  i++)
         ;
     /*endfor*/
     feedback_count = i;
-    FrameMgrSetIterCount (fm, feedback_count);
 
-    total_size = FrameMgrGetTotalSize (fm);
-    reply = (unsigned char *) malloc (total_size);
-    if (!reply)
-    {
-        _Xi18nSendMessage (ims, connect_id, XIM_ERROR, 0, 0, 0);
+    total_size = _Xi18nPreeditDrawSize (draw->text->length, feedback_count);
+    reply = _Xi18nReserveMessage (ims, connect_id, total_size);
+    if (reply == NULL)
         return False;
-    }
     /*endif*/
-    memset (reply, 0, total_size);
-    FrameMgrSetBuffer (fm, reply);
-
-    FrameMgrPutToken (fm, connect_id);
-    FrameMgrPutToken (fm, preedit_CB->icid);
-    FrameMgrPutToken (fm, draw->caret);
-    FrameMgrPutToken (fm, draw->chg_first);
-    FrameMgrPutToken (fm, draw->chg_length);
-    FrameMgrPutToken (fm, status);
-    FrameMgrPutToken (fm, draw->text->length);
-    FrameMgrPutToken (fm, draw->text->string);
-    for (i = 0;  i < feedback_count;  i++)
-        FrameMgrPutToken (fm, draw->text->feedback[i]);
-    /*endfor*/
-    
-    _Xi18nSendMessage (ims,
-                       connect_id,
-                       XIM_PREEDIT_DRAW,
-                       0,
-                       reply,
-                       total_size);
-    FrameMgrFree (fm);
-    free (reply);
+    _Xi18nEncodePreeditDraw (reply,
+                             _Xi18nNeedSwap (i18n_core, connect_id),
+                             connect_id,
+                             preedit_CB->icid,
+                             draw->caret,
+                             draw->chg_first,
+                             draw->chg_length,
+                             status,
+                             draw->text->string.multi_byte,
+                             draw->text->length,
+                             draw->text->feedback,
+                             feedback_count);
+    _Xi18nCommitMessage (ims,
+                         connect_id,
+                         XIM_PREEDIT_DRAW,
+                         0,
+                         total_size);
 
     /* XIM_PREEDIT_DRAW is an asyncronous protocol, so return immediately. */
     return True;
@@ -507,18 +488,10 @@ int _Xi18nStringConversionCallback (XIMS ims, IMProtocol *call_data)
 
     /* XIM_STR_CONVERSION is a syncronous protocol,
        so should wait here for XIM_STR_CONVERSION_REPLY.
-       But if XIM waits for a reply here, it would make xim 
-       unusable to other clients.
+       But many clients never reply, and holding their key events
+       until the wait runs out would make xim unusable to them.
        So it would be better not to wait here.
        XIM can deal with it in the IMProtocol handler, when
-       XIM_STR_CONVERSION_REPLY message is received.
-    if (i18n_core->methods.wait (ims,
-                                 connect_id,
-                                 XIM_STR_CONVERSION_REPLY,
-                                 0) == False)
-    {
-        return False;
-    }
-    */
+       XIM_STR_CONVERSION_REPLY message is received. */
     return True;
 }
@@ -0,0 +1,410 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+
+/*
+ * Hand-written codecs for the frames that are sent or received on every
+ * key stroke. Each one is the straight-line equivalent of the frame
+ * template in i18nIMProto.c which it names, and has to produce the same
+ * bytes as FrameMgr does with that template. Change them together.
+ *
+ * The worker functions take the byte order as a plain argument and the
+ * exported ones call them with a constant True or False, so that the
+ * compiler can make a native and a byte swapped copy of each without the
+ * per token dispatch of FrameMgr.
+ *
+ * Like FrameMgr, they assume the buffer is 4 byte aligned.
+ */
+
+#include <string.h>
+#include <X11/Xlib.h>
+#include "FrameMgr.h"
+#include "IMdkit.h"
+#include "Xi18n.h"
+#include "XimFunc.h"
+
+#define CodecSwap16(n) \
+    ((CARD16) (((n) << 8 & 0xFF00) | ((n) >> 8 & 0xFF)))
+#define CodecSwap32(n) \
+    ((CARD32) (((n) << 24 & 0xFF000000) | \
+               ((n) <<  8 & 0xFF0000) |   \
+               ((n) >>  8 & 0xFF00) |     \
+               ((n) >> 24 & 0xFF)))
+
+#define CodecPad4(n)		((4 - ((n) % 4)) % 4)
+
+#define PUT16(p, n, swap) \
+    (*(CARD16 *) (p) = (swap) ? CodecSwap16 ((CARD16) (n)) : (CARD16) (n))
+#define PUT32(p, n, swap) \
+    (*(CARD32 *) (p) = (swap) ? CodecSwap32 ((CARD32) (n)) : (CARD32) (n))
+#define GET16(p, swap) \
+    ((swap) ? CodecSwap16 (*(CARD16 *) (p)) : *(CARD16 *) (p))
+#define GET32(p, swap) \
+    ((swap) ? CodecSwap32 (*(CARD32 *) (p)) : *(CARD32 *) (p))
+
+/* forward_event_fr */
+
+static int EncodeForwardEvent (unsigned char *buf,
+                               Bool swap,
+                               CARD16 connect_id,
+                               CARD16 icid,
+                               CARD16 flag,
+                               CARD16 serial)
+{
+    PUT16 (buf, connect_id, swap);
+    PUT16 (buf + 2, icid, swap);
+    PUT16 (buf + 4, flag, swap);
+    PUT16 (buf + 6, serial, swap);
+    return 8;
+}
+
+int _Xi18nEncodeForwardEvent (unsigned char *buf,
+                              Bool swap,
+                              CARD16 connect_id,
+                              CARD16 icid,
+                              CARD16 flag,
+                              CARD16 serial)
+{
+    if (swap)
+        return EncodeForwardEvent (buf, True, connect_id, icid, flag, serial);
+    /*endif*/
+    return EncodeForwardEvent (buf, False, connect_id, icid, flag, serial);
+}
+
+static int DecodeForwardEvent (unsigned char *p,
+                               Bool swap,
+                               CARD16 *connect_id,
+                               CARD16 *icid,
+                               CARD16 *flag,
+                               CARD16 *serial)
+{
+    *connect_id = GET16 (p, swap);
+    *icid = GET16 (p + 2, swap);
+    *flag = GET16 (p + 4, swap);
+    *serial = GET16 (p + 6, swap);
+    return 8;
+}
+
+int _Xi18nDecodeForwardEvent (unsigned char *p,
+                              Bool swap,
+                              CARD16 *connect_id,
+                              CARD16 *icid,
+                              CARD16 *flag,
+                              CARD16 *serial)
+{
+    if (swap)
+        return DecodeForwardEvent (p, True, connect_id, icid, flag, serial);
+    /*endif*/
+    return DecodeForwardEvent (p, False, connect_id, icid, flag, serial);
+}
+
+/* ext_forward_keyevent_fr */
+
+static int EncodeExtForwardKeyEvent (unsigned char *buf,
+                                     Bool swap,
+                                     CARD16 connect_id,
+                                     CARD16 icid,
+                                     CARD16 flag,
+                                     CARD16 serial,
+                                     CARD8 type,
+                                     CARD8 keycode,
+                                     CARD16 state,
+                                     CARD32 time,
+                                     CARD32 window)
+{
+    PUT16 (buf, connect_id, swap);
+    PUT16 (buf + 2, icid, swap);
+    PUT16 (buf + 4, flag, swap);
+    PUT16 (buf + 6, serial, swap);
+    buf[8] = type;
+    buf[9] = keycode;
+    PUT16 (buf + 10, state, swap);
+    PUT32 (buf + 12, time, swap);
+    PUT32 (buf + 16, window, swap);
+    return 20;
+}
+
+int _Xi18nEncodeExtForwardKeyEvent (unsigned char *buf,
+                                    Bool swap,
+                                    CARD16 connect_id,
+                                    CARD16 icid,
+                                    CARD16 flag,
+                                    CARD16 serial,
+                                    CARD8 type,
+                                    CARD8 keycode,
+                                    CARD16 state,
+                                    CARD32 time,
+                                    CARD32 window)
+{
+    if (swap)
+        return EncodeExtForwardKeyEvent (buf, True, connect_id, icid,
+                                         flag, serial, type, keycode,
+                                         state, time, window);
+    /*endif*/
+    return EncodeExtForwardKeyEvent (buf, False, connect_id, icid,
+                                     flag, serial, type, keycode,
+                                     state, time, window);
+}
+
+/* commit_chars_fr */
+
+int _Xi18nCommitCharsSize (int length)
+{
+    return 8 + length + CodecPad4 (length);
+}
+
+static int EncodeCommitChars (unsigned char *buf,
+                              Bool swap,
+                              CARD16 connect_id,
+                              CARD16 icid,
+                              CARD16 flag,
+                              const char *str,
+                              CARD16 length)
+{
+    int pad = CodecPad4 (length);
+
+    PUT16 (buf, connect_id, swap);
+    PUT16 (buf + 2, icid, swap);
+    PUT16 (buf + 4, flag, swap);
+    PUT16 (buf + 6, length, swap);
+    memcpy (buf + 8, str, length);
+    memset (buf + 8 + length, 0, pad);
+    return 8 + length + pad;
+}
+
+int _Xi18nEncodeCommitChars (unsigned char *buf,
+                             Bool swap,
+                             CARD16 connect_id,
+                             CARD16 icid,
+                             CARD16 flag,
+                             const char *str,
+                             CARD16 length)
+{
+    if (swap)
+        return EncodeCommitChars (buf, True,
+                                  connect_id, icid, flag, str, length);
+    /*endif*/
+    return EncodeCommitChars (buf, False,
+                              connect_id, icid, flag, str, length);
+}
+
+/* preedit_draw_fr */
+
+int _Xi18nPreeditDrawSize (int length, int feedback_count)
+{
+    return 20 + 2 + length + CodecPad4 (2 + length)
+           + 4 + 4*feedback_count;
+}
+
+static int EncodePreeditDraw (unsigned char *buf,
+                              Bool swap,
+                              CARD16 connect_id,
+                              CARD16 icid,
+                              CARD32 caret,
+                              CARD32 chg_first,
+                              CARD32 chg_length,
+                              CARD32 status,
+                              const char *str,
+                              CARD16 length,
+                              const XIMFeedback *feedback,
+                              int feedback_count)
+{
+    unsigned char *p;
+    int pad = CodecPad4 (2 + length);
+    int i;
+
+    PUT16 (buf, connect_id, swap);
+    PUT16 (buf + 2, icid, swap);
+    PUT32 (buf + 4, caret, swap);
+    PUT32 (buf + 8, chg_first, swap);
+    PUT32 (buf + 12, chg_length, swap);
+    PUT32 (buf + 16, status, swap);
+    PUT16 (buf + 20, length, swap);
+    p = buf + 22;
+    if (length > 0)
+        memcpy (p, str, length);
+    /*endif*/
+    p += length;
+    memset (p, 0, pad);
+    p += pad;
+
+    /* byte length of the feedback list and 2 bytes of padding */
+    PUT16 (p, 4*feedback_count, swap);
+    PUT16 (p + 2, 0, swap);
+    p += 4;
+    for (i = 0;  i < feedback_count;  i++)
+    {
+        PUT32 (p, feedback[i], swap);
+        p += 4;
+    }
+    /*endfor*/
+    return p - buf;
+}
+
+int _Xi18nEncodePreeditDraw (unsigned char *buf,
+                             Bool swap,
+                             CARD16 connect_id,
+                             CARD16 icid,
+                             CARD32 caret,
+                             CARD32 chg_first,
+                             CARD32 chg_length,
+                             CARD32 status,
+                             const char *str,
+                             CARD16 length,
+                             const XIMFeedback *feedback,
+                             int feedback_count)
+{
+    if (swap)
+        return EncodePreeditDraw (buf, True, connect_id, icid,
+                                  caret, chg_first, chg_length, status,
+                                  str, length, feedback, feedback_count);
+    /*endif*/
+    return EncodePreeditDraw (buf, False, connect_id, icid,
+                              caret, chg_first, chg_length, status,
+                              str, length, feedback, feedback_count);
+}
+
+/* create_ic_fr, set_ic_values_fr and xicattribute_fr
+ *
+ * The header decoders return the offset of the first XICATTRIBUTE,
+ * _Xi18nDecodeICAttribute returns the size of the one it has read. */
+
+int _Xi18nDecodeCreateIC (unsigned char *p,
+                          Bool swap,
+                          CARD16 *connect_id,
+                          CARD16 *byte_length)
+{
+    if (swap)
+    {
+        *connect_id = GET16 (p, True);
+        *byte_length = GET16 (p + 2, True);
+    }
+    else
+    {
+        *connect_id = GET16 (p, False);
+        *byte_length = GET16 (p + 2, False);
+    }
+    /*endif*/
+    return 4;
+}
+
+int _Xi18nDecodeSetICValues (unsigned char *p,
+                             Bool swap,
+                             CARD16 *connect_id,
+                             CARD16 *icid,
+                             CARD16 *byte_length)
+{
+    if (swap)
+    {
+        *connect_id = GET16 (p, True);
+        *icid = GET16 (p + 2, True);
+        *byte_length = GET16 (p + 4, True);
+    }
+    else
+    {
+        *connect_id = GET16 (p, False);
+        *icid = GET16 (p + 2, False);
+        *byte_length = GET16 (p + 4, False);
+    }
+    /*endif*/
+    /* 2 bytes of padding follow the byte length */
+    return 8;
+}
+
+int _Xi18nDecodeICAttribute (unsigned char *p,
+                             Bool swap,
+                             CARD16 *attribute_id,
+                             CARD16 *value_length,
+                             unsigned char **value)
+{
+    if (swap)
+    {
+        *attribute_id = GET16 (p, True);
+        *value_length = GET16 (p + 2, True);
+    }
+    else
+    {
+        *attribute_id = GET16 (p, False);
+        *value_length = GET16 (p + 2, False);
+    }
+    /*endif*/
+    *value = p + 4;
+    return 4 + *value_length + CodecPad4 (*value_length);
+}
+
+/* short_fr, long_fr, xpoint_fr and xrectangle_fr, the values of the IC
+   attributes. These are cheap enough to take the byte order at run time. */
+
+CARD16 _Xi18nDecodeCard16 (unsigned char *p, Bool swap)
+{
+    return GET16 (p, swap);
+}
+
+CARD32 _Xi18nDecodeCard32 (unsigned char *p, Bool swap)
+{
+    return GET32 (p, swap);
+}
+
+int _Xi18nDecodePoint (unsigned char *p, Bool swap, XPoint *point)
+{
+    point->x = (short) GET16 (p, swap);
+    point->y = (short) GET16 (p + 2, swap);
+    return 4;
+}
+
+int _Xi18nDecodeRectangle (unsigned char *p, Bool swap, XRectangle *rect)
+{
+    rect->x = (short) GET16 (p, swap);
+    rect->y = (short) GET16 (p + 2, swap);
+    rect->width = GET16 (p + 4, swap);
+    rect->height = GET16 (p + 6, swap);
+    return 8;
+}
+
+/* create_ic_reply_fr and set_ic_values_reply_fr */
+
+int _Xi18nEncodeICReply (unsigned char *buf,
+                         Bool swap,
+                         CARD16 connect_id,
+                         CARD16 icid)
+{
+    PUT16 (buf, connect_id, swap);
+    PUT16 (buf + 2, icid, swap);
+    return 4;
+}
+
+/* sync_reply_fr */
+
+int _Xi18nDecodeSyncReply (unsigned char *p,
+                           Bool swap,
+                           CARD16 *connect_id,
+                           CARD16 *icid)
+{
+    if (swap)
+    {
+        *connect_id = GET16 (p, True);
+        *icid = GET16 (p + 2, True);
+    }
+    else
+    {
+        *connect_id = GET16 (p, False);
+        *icid = GET16 (p + 2, False);
+    }
+    /*endif*/
+    return 4;
+}
@@ -38,143 +38,111 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #define IC_SIZE 64
 
 /* Set IC values */
+static void SetAttributeHeader (XICAttribute *value_ret,
+                                XICAttr *ic_attr,
+                                int value_length)
+{
+    value_ret->attribute_id = ic_attr->attribute_id;
+    value_ret->name = ic_attr->name;
+    value_ret->name_length = ic_attr->length;
+    value_ret->type = ic_attr->type;
+    value_ret->kind = ic_attr->kind;
+    value_ret->value_length = value_length;
+    value_ret->value = NULL;
+}
+
 static void SetCardAttribute (XICAttribute *value_ret,
-                              char *p,
+                              unsigned char *p,
                               XICAttr *ic_attr,
                               int value_length,
                               int need_swap)
 {
-    char *buf;
-    FrameMgr fm;
-
-    if ((buf = (char *) malloc (value_length)) == NULL)
-        return;
-    /*endif*/
+    SetAttributeHeader (value_ret, ic_attr, value_length);
+    value_ret->small.card = 0;
     if (value_length == sizeof (CARD8))
     {
-        memmove (buf, p, value_length);
+        memmove (&value_ret->small, p, value_length);
     }
     else if (value_length == sizeof (CARD16))
     {
-        INT16 value;
-        extern XimFrameRec short_fr[];
+        INT16 value = (INT16) _Xi18nDecodeCard16 (p, need_swap);
 
-        fm = FrameMgrInit (short_fr, (char *) p, need_swap);
-        /* get data */
-        FrameMgrGetToken (fm, value);
-        FrameMgrFree (fm);
-        memmove (buf, &value, value_length);
+        memmove (&value_ret->small, &value, value_length);
     }
     else if (value_length == sizeof(CARD32))
     {
-        INT32 value;
-        extern XimFrameRec long_fr[];
-        
-        fm = FrameMgrInit (long_fr, (char *) p, need_swap);
-        /* get data */
-        FrameMgrGetToken (fm, value);
-        FrameMgrFree (fm);
-        memmove (buf, &value, value_length);
+        value_ret->small.card = _Xi18nDecodeCard32 (p, need_swap);
     }
     /*endif*/
-    value_ret->attribute_id = ic_attr->attribute_id;
-    value_ret->name = ic_attr->name;
-    value_ret->name_length = ic_attr->length;
-    value_ret->type = ic_attr->type;
-    value_ret->value_length = value_length;
-    value_ret->value = buf;
+    value_ret->value = &value_ret->small;
 }
 
 static void SetFontAttribute (XICAttribute *value_ret,
-                              char *p,
+                              unsigned char *p,
                               XICAttr *ic_attr,
                               int value_length,
                               int need_swap)
 {
     char *buf;
-    char *base_name;
     CARD16 base_length;
-    FrameMgr fm;
-    extern XimFrameRec fontset_fr[];
 
-    fm = FrameMgrInit (fontset_fr, (char *) p, need_swap);
-    /* get data */
-    FrameMgrGetToken (fm, base_length);
-    FrameMgrSetSize (fm, base_length);
+    SetAttributeHeader (value_ret, ic_attr, value_length);
+
+    /* fontset_fr */
+    base_length = _Xi18nDecodeCard16 (p, need_swap);
+    if ((int) sizeof (CARD16) + base_length > value_length)
+        return;
+    /*endif*/
     if ((buf = (char *) malloc (base_length + 1)) == NULL)
         return;
     /*endif*/
-    FrameMgrGetToken (fm, base_name);
-    FrameMgrFree(fm);
-    strncpy (buf, base_name, base_length);
+    memmove (buf, p + sizeof (CARD16), base_length);
     buf[base_length] = (char) 0;
 
-    value_ret->attribute_id = ic_attr->attribute_id;
-    value_ret->name = ic_attr->name;
-    value_ret->name_length = ic_attr->length;
-    value_ret->type = ic_attr->type;
-    value_ret->value_length = value_length;
     value_ret->value = buf;
 }
 
 static void SetPointAttribute (XICAttribute *value_ret,
-                               char *p,
+                               unsigned char *p,
                                XICAttr *ic_attr,
                                int value_length,
                                int need_swap)
 {
-    XPoint *buf;
-    FrameMgr fm;
-    extern XimFrameRec xpoint_fr[];
-
-    if ((buf = (XPoint *) malloc (sizeof (XPoint))) == NULL)
+    SetAttributeHeader (value_ret, ic_attr, value_length);
+    if (value_length < 4)
         return;
     /*endif*/
-
-    fm = FrameMgrInit (xpoint_fr, (char *) p, need_swap);
-    /* get data */
-    FrameMgrGetToken (fm, buf->x);
-    FrameMgrGetToken (fm, buf->y);
-    FrameMgrFree (fm);
-
-    value_ret->attribute_id = ic_attr->attribute_id;
-    value_ret->name = ic_attr->name;
-    value_ret->name_length = ic_attr->length;
-    value_ret->type = ic_attr->type;
-    value_ret->value_length = value_length;
-    value_ret->value = (char *) buf;
+    _Xi18nDecodePoint (p, need_swap, &value_ret->small.point);
+    value_ret->value = &value_ret->small;
 }
 
 static void SetRectAttribute (XICAttribute *value_ret,
-                              char *p,
+                              unsigned char *p,
                               XICAttr *ic_attr,
                               int value_length,
                               int need_swap)
 {
-    XRectangle *buf;
-    FrameMgr fm;
-    extern XimFrameRec xrectangle_fr[];
-
-    if ((buf = (XRectangle *) malloc (sizeof (XRectangle))) == NULL)
+    SetAttributeHeader (value_ret, ic_attr, value_length);
+    if (value_length < 8)
         return;
     /*endif*/
-    
-    fm = FrameMgrInit (xrectangle_fr, (char *) p, need_swap);
-    /* get data */
-    FrameMgrGetToken (fm, buf->x);
-    FrameMgrGetToken (fm, buf->y);
-    FrameMgrGetToken (fm, buf->width);
-    FrameMgrGetToken (fm, buf->height);
-    FrameMgrFree (fm);
+    _Xi18nDecodeRectangle (p, need_swap, &value_ret->small.rect);
+    value_ret->value = &value_ret->small;
+}
 
-    value_ret->attribute_id = ic_attr->attribute_id;
-    value_ret->name = ic_attr->name;
-    value_ret->name_length = ic_attr->length;
-    value_ret->type = ic_attr->type;
-    value_ret->value_length = value_length;
-    value_ret->value = (char *) buf;
+static void FreeAttributeValue (XICAttribute *attr)
+{
+    if (attr->value != NULL  &&  attr->value != (void *) &attr->small)
+        free (attr->value);
+    /*endif*/
+}
 
-    return;
+static XICAttr *FindICAttr (Xi18n i18n_core, CARD16 icvalue_id)
+{
+    if (icvalue_id < i18n_core->address.ic_attr_num)
+        return &i18n_core->address.xic_attr[icvalue_id];
+    /*endif*/
+    return NULL;
 }
 
 #if 0
@@ -317,53 +285,44 @@ static int ReadICValue (Xi18n i18n_core,
                         CARD16 *number_ret,
                         int need_swap)
 {
-    XICAttr *ic_attr = i18n_core->address.xic_attr;
-    int i;
+    XICAttr *ic_attr = FindICAttr (i18n_core, icvalue_id);
 
     *number_ret = (CARD16) 0;
 
-    for (i = 0;  i < i18n_core->address.ic_attr_num;  i++, ic_attr++)
-    {
-        if (ic_attr->attribute_id == icvalue_id)
-            break;
-        /*endif*/
-    }
-    /*endfor*/
+    if (ic_attr == NULL)
+        return 0;
+    /*endif*/
     switch (ic_attr->type)
     {
     case XimType_NEST:
         {
             int total_length = 0;
             CARD16 attribute_ID;
-            INT16 attribute_length;
+            CARD16 attribute_length;
             unsigned char *p1 = (unsigned char *) p;
+            unsigned char *value;
             CARD16 ic_len = 0;
             CARD16 number;
-            FrameMgr fm;
-            extern XimFrameRec attr_head_fr[];
+            int size;
 
             while (total_length < value_length)
             {
-                fm = FrameMgrInit (attr_head_fr, (char *) p1, need_swap);
-                /* get data */
-                FrameMgrGetToken (fm, attribute_ID);
-                FrameMgrGetToken (fm, attribute_length);
-                FrameMgrFree (fm);
-                p1 += sizeof (CARD16)*2;
+                size = _Xi18nDecodeICAttribute (p1,
+                                                need_swap,
+                                                &attribute_ID,
+                                                &attribute_length,
+                                                &value);
                 ReadICValue (i18n_core,
                              attribute_ID,
                              attribute_length,
-                             p1,
-                             (value_ret + ic_len),
+                             value,
+                             (value_ret + *number_ret),
                              &number,
                              need_swap);
                 ic_len++;
                 *number_ret += number;
-                p1 += attribute_length;
-                p1 += IMPAD (attribute_length);
-                total_length += (CARD16) sizeof(CARD16)*2
-                                + (INT16) attribute_length
-                                + IMPAD (attribute_length);
+                p1 += size;
+                total_length += size;
             }
 	    /*endwhile*/
             return ic_len;
@@ -522,22 +481,9 @@ static XICAttribute *CreateNestedList (CARD16 attr_id,
 
 static Bool IsNestedList (Xi18n i18n_core, CARD16 icvalue_id)
 {
-    XICAttr *ic_attr = i18n_core->address.xic_attr;
-    int i;
+    XICAttr *ic_attr = FindICAttr (i18n_core, icvalue_id);
 
-    for (i = 0;  i < i18n_core->address.ic_attr_num;  i++, ic_attr++)
-    {
-        if (ic_attr->attribute_id == icvalue_id)
-        {
-            if (ic_attr->type == XimType_NEST)
-                return True;
-            /*endif*/
-            return False;
-        }
-        /*endif*/
-    }
-    /*endfor*/
-    return False;
+    return ic_attr != NULL  &&  ic_attr->type == XimType_NEST;
 }
 
 static Bool IsSeparator (Xi18n i18n_core, CARD16 icvalue_id)
@@ -545,14 +491,24 @@ static Bool IsSeparator (Xi18n i18n_core, CARD16 icvalue_id)
     return (i18n_core->address.separatorAttr_id == icvalue_id);
 }
 
+static void SetAttributeName (XICAttribute *attr_ret, XICAttr *xic_attr)
+{
+    attr_ret->attribute_id = xic_attr->attribute_id;
+    attr_ret->name_length = xic_attr->length;
+    attr_ret->name = xic_attr->name;
+    attr_ret->type = xic_attr->type;
+    attr_ret->kind = xic_attr->kind;
+    attr_ret->value_length = 0;
+    attr_ret->value = NULL;
+}
+
 static int GetICValue (Xi18n i18n_core,
                        XICAttribute *attr_ret,
                        CARD16 *id_list,
                        int list_num)
 {
-    XICAttr *xic_attr = i18n_core->address.xic_attr;
+    XICAttr *xic_attr;
     register int i;
-    register int j;
     register int n;
 
     i =
@@ -562,42 +518,25 @@ static int GetICValue (Xi18n i18n_core,
         i++;
         while (i < list_num  &&  !IsSeparator (i18n_core, id_list[i]))
         {
-            for (j = 0;  j < i18n_core->address.ic_attr_num;  j++)
-            {
-                if (xic_attr[j].attribute_id == id_list[i])
-                {
-                    attr_ret[n].attribute_id = xic_attr[j].attribute_id;
-                    attr_ret[n].name_length = xic_attr[j].length;
-                    attr_ret[n].name = malloc (xic_attr[j].length + 1);
-		    strcpy(attr_ret[n].name, xic_attr[j].name);
-                    attr_ret[n].type = xic_attr[j].type;
-                    n++;
-                    i++;
-                    break;
-                }
-                /*endif*/
-            }
-            /*endfor*/
+            xic_attr = FindICAttr (i18n_core, id_list[i]);
+            if (xic_attr == NULL)
+                break;
+            /*endif*/
+            SetAttributeName (&attr_ret[n], xic_attr);
+            n++;
+            i++;
         }
         /*endwhile*/
     }
     else
     {
-        for (j = 0;  j < i18n_core->address.ic_attr_num;  j++)
+        xic_attr = FindICAttr (i18n_core, id_list[i]);
+        if (xic_attr != NULL)
         {
-            if (xic_attr[j].attribute_id == id_list[i])
-            {
-                attr_ret[n].attribute_id = xic_attr[j].attribute_id;
-                attr_ret[n].name_length = xic_attr[j].length;
-                attr_ret[n].name = malloc (xic_attr[j].length + 1);
-		strcpy(attr_ret[n].name, xic_attr[j].name);
-                attr_ret[n].type = xic_attr[j].type;
-                n++;
-                break;
-            }
-            /*endif*/
+            SetAttributeName (&attr_ret[n], xic_attr);
+            n++;
         }
-        /*endfor*/
+        /*endif*/
     }
     /*endif*/
     return n;
@@ -610,14 +549,18 @@ void _Xi18nChangeIC (XIMS ims,
                      int create_flag)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    FmStatus status;
     CARD16 byte_length;
-    register int total_size;
-    unsigned char *reply = NULL;
+    int need_swap;
+    unsigned char *reply;
     register int i;
     register int attrib_num;
-    XICAttribute *attrib_list;
+    /* the values point into the message, they are read from there */
+    struct
+    {
+        CARD16 attribute_id;
+        CARD16 value_length;
+        unsigned char *value;
+    } attrib_list[IC_SIZE];
     XICAttribute pre_attr[IC_SIZE];
     XICAttribute sts_attr[IC_SIZE];
     XICAttribute ic_attr[IC_SIZE];
@@ -626,60 +569,49 @@ void _Xi18nChangeIC (XIMS ims,
     CARD16 ic_num = 0;
     CARD16 connect_id = call_data->any.connect_id;
     IMChangeICStruct *changeic = (IMChangeICStruct *) &call_data->changeic;
-    extern XimFrameRec create_ic_fr[];
-    extern XimFrameRec create_ic_reply_fr[];
-    extern XimFrameRec set_ic_values_fr[];
-    extern XimFrameRec set_ic_values_reply_fr[];
     CARD16 input_method_ID;
 
-    memset (pre_attr, 0, sizeof (XICAttribute)*IC_SIZE);
-    memset (sts_attr, 0, sizeof (XICAttribute)*IC_SIZE);
-    memset (ic_attr, 0, sizeof (XICAttribute)*IC_SIZE);
-
+    need_swap = _Xi18nNeedSwap (i18n_core, connect_id);
     if (create_flag == True)
     {
-        fm = FrameMgrInit (create_ic_fr,
-                           (char *) p,
-                           _Xi18nNeedSwap (i18n_core, connect_id));
-        /* get data */
-        FrameMgrGetToken (fm, input_method_ID);
-        FrameMgrGetToken (fm, byte_length);
+        p += _Xi18nDecodeCreateIC (p,
+                                   need_swap,
+                                   &input_method_ID,
+                                   &byte_length);
     }
     else
     {
-        fm = FrameMgrInit (set_ic_values_fr,
-                           (char *) p,
-                           _Xi18nNeedSwap (i18n_core, connect_id));
-        /* get data */
-        FrameMgrGetToken (fm, input_method_ID);
-        FrameMgrGetToken (fm, changeic->icid);
-        FrameMgrGetToken (fm, byte_length);
+        p += _Xi18nDecodeSetICValues (p,
+                                      need_swap,
+                                      &input_method_ID,
+                                      &changeic->icid,
+                                      &byte_length);
     }
     /*endif*/
-    attrib_list = (XICAttribute *) malloc (sizeof (XICAttribute)*IC_SIZE);
-    if (!attrib_list)
-    {
-        _Xi18nSendMessage (ims, connect_id, XIM_ERROR, 0, 0, 0);
-        return;
-    }
-    /*endif*/
-    memset (attrib_list, 0, sizeof(XICAttribute)*IC_SIZE);
 
     attrib_num = 0;
-    while (FrameMgrIsIterLoopEnd (fm, &status) == False)
-    {
-        void *value;
-        int value_length;
-        
-        FrameMgrGetToken (fm, attrib_list[attrib_num].attribute_id);
-        FrameMgrGetToken (fm, value_length);
-        FrameMgrSetSize (fm, value_length);
+    while (byte_length > 0  &&  attrib_num < IC_SIZE)
+    {
+        unsigned char *value;
+        CARD16 attribute_id;
+        CARD16 value_length;
+        int size;
+
+        size = _Xi18nDecodeICAttribute (p,
+                                        need_swap,
+                                        &attribute_id,
+                                        &value_length,
+                                        &value);
+        attrib_list[attrib_num].attribute_id = attribute_id;
         attrib_list[attrib_num].value_length = value_length;
-        FrameMgrGetToken (fm, value);
-        attrib_list[attrib_num].value = (void *) malloc (value_length + 1);
-        memmove (attrib_list[attrib_num].value, value, value_length);
-	((char *)attrib_list[attrib_num].value)[value_length] = '\0';
+        attrib_list[attrib_num].value = value;
         attrib_num++;
+
+        if (size >= byte_length)
+            break;
+        /*endif*/
+        p += size;
+        byte_length -= size;
     }
     /*endwhile*/
 
@@ -698,7 +630,7 @@ void _Xi18nChangeIC (XIMS ims,
                              attrib_list[i].value,
                              &pre_attr[preedit_ic_num],
                              &number,
-                             _Xi18nNeedSwap(i18n_core, connect_id));
+                             need_swap);
                 preedit_ic_num += number;
             }
             else if (attrib_list[i].attribute_id == i18n_core->address.statusAttr_id)
@@ -709,7 +641,7 @@ void _Xi18nChangeIC (XIMS ims,
                              attrib_list[i].value,
                              &sts_attr[status_ic_num],
                              &number,
-                             _Xi18nNeedSwap (i18n_core, connect_id));
+                             need_swap);
                 status_ic_num += number;
             }
             else
@@ -726,18 +658,12 @@ void _Xi18nChangeIC (XIMS ims,
                          attrib_list[i].value,
                          &ic_attr[ic_num],
                          &number,
-                         _Xi18nNeedSwap (i18n_core, connect_id));
+                         need_swap);
             ic_num += number;
         }
         /*endif*/
     }
     /*endfor*/
-    for (i = 0;  i < attrib_num;  i++)
-        free (attrib_list[i].value);
-    /*endfor*/
-    free (attrib_list);
-
-    FrameMgrFree (fm);
 
     changeic->preedit_attr_num = preedit_ic_num;
     changeic->status_attr_num = status_ic_num;
@@ -756,58 +682,25 @@ void _Xi18nChangeIC (XIMS ims,
 
     /* Here, we must free value of ic_attr, pre_attr and sts_attr */ 
     for (i = 0; i < ic_num; i++)
-	free (ic_attr[i].value);
+	FreeAttributeValue (&ic_attr[i]);
     for (i = 0; i < preedit_ic_num; i++)
-	free (pre_attr[i].value);
+	FreeAttributeValue (&pre_attr[i]);
     for (i = 0; i < status_ic_num; i++)
-	free (sts_attr[i].value);
+	FreeAttributeValue (&sts_attr[i]);
 
-    if (create_flag == True)
-    {
-        fm = FrameMgrInit (create_ic_reply_fr,
-                           NULL,
-                           _Xi18nNeedSwap (i18n_core, connect_id));
-    }
-    else
-    {
-        fm = FrameMgrInit (set_ic_values_reply_fr,
-                           NULL,
-                           _Xi18nNeedSwap (i18n_core, connect_id));
-    }
-    /*endif*/
-    total_size = FrameMgrGetTotalSize (fm);
-    reply = (unsigned char *) malloc (total_size);
-    if (!reply)
-    {
-        _Xi18nSendMessage (ims, connect_id, XIM_ERROR, 0, 0, 0);
+    /* create_ic_reply_fr and set_ic_values_reply_fr are the same */
+    reply = _Xi18nReserveMessage (ims, connect_id, 4);
+    if (reply == NULL)
         return;
-    }
-    /*endif*/
-    memset (reply, 0, total_size);
-    FrameMgrSetBuffer (fm, reply);
-
-    FrameMgrPutToken (fm, input_method_ID);
-    FrameMgrPutToken (fm, changeic->icid);
-
-    if (create_flag == True)
-    {
-        _Xi18nSendMessage (ims,
-                           connect_id,
-                           XIM_CREATE_IC_REPLY,
-                           0,
-                           reply,
-                           total_size);
-    }
-    else
-    {
-        _Xi18nSendMessage (ims,
-                           connect_id,
-                           XIM_SET_IC_VALUES_REPLY,
-                           0,
-                           reply,
-                           total_size);
-    }
     /*endif*/
+    _Xi18nEncodeICReply (reply, need_swap, input_method_ID, changeic->icid);
+    _Xi18nCommitMessage (ims,
+                         connect_id,
+                         create_flag == True
+                             ?  XIM_CREATE_IC_REPLY
+                             :  XIM_SET_IC_VALUES_REPLY,
+                         0,
+                         4);
     if (create_flag == True)
     {
         int on_key_num = i18n_core->address.on_keys.count_keys;
@@ -833,8 +726,6 @@ void _Xi18nChangeIC (XIMS ims,
         /*endif*/
     }
     /*endif*/
-    FrameMgrFree (fm);
-    free (reply);
 }
 
 /* called from GetICValueMessageProc */
@@ -915,6 +806,7 @@ void _Xi18nGetIC (XIMS ims, IMProtocol *call_data, unsigned char *p)
             else
             {
                 /* another nested list.. possible? */
+                i++;
             }
             /*endif*/
         }
@@ -924,7 +816,8 @@ void _Xi18nGetIC (XIMS ims, IMProtocol *call_data, unsigned char *p)
                                       &ic_attr[ic_count],
                                       &attrID_list[i],
                                       number);
-            i += read_number;
+            /* skip an id we do not know */
+            i += read_number > 0  ?  read_number  :  1;
             ic_count += read_number;
         }
         /*endif*/
@@ -1026,34 +919,13 @@ void _Xi18nGetIC (XIMS ims, IMProtocol *call_data, unsigned char *p)
     free (attrID_list);
 
     for (i = 0;  i < (int) getic->ic_attr_num;  i++)
-    {
-	if (getic->ic_attr[i].name)
-	    free (getic->ic_attr[i].name);
-	/*endif*/
-        if (getic->ic_attr[i].value)
-            free (getic->ic_attr[i].value);
-        /*endif*/
-    }
+        FreeAttributeValue (&getic->ic_attr[i]);
     /*endfor*/
     for (i = 0;  i < (int) getic->preedit_attr_num;  i++)
-    {
-	if (getic->preedit_attr[i].name)
-	    free (getic->preedit_attr[i].name);
-	/*endif*/
-	if (getic->preedit_attr[i].value)
-	    free (getic->preedit_attr[i].value);
-	/*endif*/
-    }
+        FreeAttributeValue (&getic->preedit_attr[i]);
     /*endfor*/
     for (i = 0;  i < (int) getic->status_attr_num;  i++)
-    {
-	if (getic->status_attr[i].name)
-	    free (getic->status_attr[i].name);
-	/*endif*/
-	if (getic->status_attr[i].value)
-	    free (getic->status_attr[i].value);
-	/*endif*/
-    }
+        FreeAttributeValue (&getic->status_attr[i]);
     /*endfor*/
     
     if (preedit_ret)
@@ -29,6 +29,10 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  
 ******************************************************************/
 
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
 #include <X11/Xlib.h>
 #include <X11/Xatom.h>
 #ifndef NEED_EVENTS
@@ -39,8 +43,11 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "FrameMgr.h"
 #include "IMdkit.h"
 #include "Xi18n.h"
+#include "Xi18nTr.h"
 #include "XimFunc.h"
 
+#include "../src/debug.h"
+
 extern Xi18nClient *_Xi18nFindClient (Xi18n, CARD16);
 
 static void *xi18n_setup (Display *, XIMArg *);
@@ -58,8 +65,6 @@ static int xi18n_syncXlib (XIMS, XPointer);
 #ifndef XIM_SERVERS
 #define XIM_SERVERS "XIM_SERVERS"
 #endif
-static Atom XIM_Servers = None;
-
 
 IMMethodsRec Xi18n_im_methods =
 {
@@ -74,18 +79,22 @@ IMMethodsRec Xi18n_im_methods =
     xi18n_preeditStart,
     xi18n_preeditEnd,
     xi18n_syncXlib,
+    _Xi18nWaitTimeout,
+    _Xi18nExpireWaits,
 };
 
 extern Bool _Xi18nCheckXAddress (Xi18n, TransportSW *, char *);
+extern Bool _Xi18nCheckXcbAddress (Xi18n, TransportSW *, char *);
 extern Bool _Xi18nCheckTransAddress (Xi18n, TransportSW *, char *);
 
 TransportSW _TransR[] =
 {
+#ifdef USE_XCB
+    {"X",               1, _Xi18nCheckXcbAddress},
+#else
     {"X",               1, _Xi18nCheckXAddress},
-#ifdef TCPCONN
-    {"tcp",             3, _Xi18nCheckTransAddress},
-    {"local",           5, _Xi18nCheckTransAddress},
 #endif
+    {"local",           5, _Xi18nCheckTransAddress},
 #ifdef DNETCONN
     {"decnet",          6, _Xi18nCheckTransAddress},
 #endif
@@ -461,35 +470,49 @@ static char *ParseArgs (Xi18n i18n_core, int mode, XIMArg *args)
     return NULL;
 }
 
+/* IMServerTransport is a comma separated list, e.g. "X/,local/host:path".
+   X/ drives i18n_core->methods; local/ can only come along with it and
+   sets up i18n_core->trans_methods. */
 static int CheckIMName (Xi18n i18n_core)
 {
     char *address = i18n_core->address.im_addr;
     int i;
 
-    for (i = 0;  _TransR[i].transportname;  i++)
+    while (address != NULL)
     {
         while (*address == ' '  ||  *address == '\t')
             address++;
         /*endwhile*/
-        if (strncmp (address,
-                     _TransR[i].transportname,
-                     _TransR[i].namelen) == 0
-            &&
-            address[_TransR[i].namelen] == '/')
+        for (i = 0;  _TransR[i].transportname;  i++)
         {
-            if (_TransR[i].checkAddr (i18n_core,
-                                      &_TransR[i],
-                                      address + _TransR[i].namelen + 1) == True)
+            if (strncmp (address,
+                         _TransR[i].transportname,
+                         _TransR[i].namelen) == 0
+                &&
+                address[_TransR[i].namelen] == '/')
             {
-                return True;
+                if (_TransR[i].checkAddr (i18n_core,
+                                          &_TransR[i],
+                                          address + _TransR[i].namelen + 1) == False)
+                {
+                    return False;
+                }
+                /*endif*/
+                break;
             }
             /*endif*/
-            return False;
         }
+        /*endfor*/
+        if (_TransR[i].transportname == NULL)
+            return False;
+        /*endif*/
+        address = strchr (address, ',');
+        if (address != NULL)
+            address++;
         /*endif*/
     }
-    /*endfor*/
-    return False;
+    /*endwhile*/
+    return i18n_core->methods.begin != NULL;
 }
 
 static int SetXi18nSelectionOwner(Xi18n i18n_core)
@@ -514,12 +537,14 @@ static int SetXi18nSelectionOwner(Xi18n i18n_core)
         return False;
     i18n_core->address.selection = atom;
 
-    if (XIM_Servers == None)
-        XIM_Servers = XInternAtom (dpy, XIM_SERVERS, False);
+    if (i18n_core->address.XIM_Servers == None)
+        i18n_core->address.XIM_Servers = XInternAtom (dpy,
+                                                      XIM_SERVERS,
+                                                      False);
     /*endif*/
     XGetWindowProperty (dpy,
                         root,
-                        XIM_Servers,
+                        i18n_core->address.XIM_Servers,
                         0L,
                         1000000L,
                         False,
@@ -554,7 +579,7 @@ static int SetXi18nSelectionOwner(Xi18n i18n_core)
         XSetSelectionOwner (dpy, atom, ims_win, CurrentTime);
         XChangeProperty (dpy,
                          root,
-                         XIM_Servers,
+                         i18n_core->address.XIM_Servers,
                          XA_ATOM,
                          32,
                          PropModePrepend,
@@ -567,7 +592,7 @@ static int SetXi18nSelectionOwner(Xi18n i18n_core)
 	 */
         XChangeProperty (dpy,
                          root,
-                         XIM_Servers,
+                         i18n_core->address.XIM_Servers,
                          XA_ATOM,
                          32,
                          PropModePrepend,
@@ -603,11 +628,13 @@ static int DeleteXi18nAtom(Xi18n i18n_core)
         return False;
     i18n_core->address.selection = atom;
 
-    if (XIM_Servers == None)
-        XIM_Servers = XInternAtom (dpy, XIM_SERVERS, False);
+    if (i18n_core->address.XIM_Servers == None)
+        i18n_core->address.XIM_Servers = XInternAtom (dpy,
+                                                      XIM_SERVERS,
+                                                      False);
     XGetWindowProperty (dpy,
                         root,
-                        XIM_Servers,
+                        i18n_core->address.XIM_Servers,
                         0L,
                         1000000L,
                         False,
@@ -636,7 +663,7 @@ static int DeleteXi18nAtom(Xi18n i18n_core)
             data[i-1] = data[i];
         XChangeProperty (dpy,
                          root,
-                         XIM_Servers,
+                         i18n_core->address.XIM_Servers,
                          XA_ATOM,
                          32,
                          PropModeReplace,
@@ -647,7 +674,7 @@ static int DeleteXi18nAtom(Xi18n i18n_core)
     else {
         XChangeProperty (dpy,
                          root,
-                         XIM_Servers,
+                         i18n_core->address.XIM_Servers,
                          XA_ATOM,
                          32,
                          PropModePrepend,
@@ -760,6 +787,12 @@ static Status xi18n_openIM(XIMS ims)
         ||
         !i18n_core->methods.begin (ims))
     {
+        if (i18n_core->address.trans_addr)
+        {
+            free (((TransSpecRec *) i18n_core->address.trans_addr)->path);
+            free (i18n_core->address.trans_addr);
+        }
+        /*endif*/
         free (i18n_core->address.im_name);
         free (i18n_core->address.im_locale);
         free (i18n_core->address.im_addr);
@@ -768,6 +801,19 @@ static Status xi18n_openIM(XIMS ims)
     }
     /*endif*/
 
+    /* the local/ transport is optional, clients can still use X/ */
+    if (i18n_core->trans_methods.begin
+        &&
+        !i18n_core->trans_methods.begin (ims))
+    {
+        nabi_log(1, "can't start local transport, use X transport only\n");
+        free (((TransSpecRec *) i18n_core->address.trans_addr)->path);
+        free (i18n_core->address.trans_addr);
+        i18n_core->address.trans_addr = NULL;
+        memset (&i18n_core->trans_methods, 0, sizeof (Xi18nMethodsRec));
+    }
+    /*endif*/
+
     _XRegisterFilterByType (dpy,
                             i18n_core->address.im_window,
                             SelectionRequest,
@@ -785,11 +831,13 @@ static Status xi18n_closeIM(XIMS ims)
 
     /* remove all client connections */
     while (i18n_core->address.clients != NULL) {
-	int connect_id = i18n_core->address.clients->connect_id;
-	i18n_core->methods.disconnect(ims, connect_id);
+	Xi18nClient *client = i18n_core->address.clients;
+	client->methods->disconnect(ims, client->connect_id);
     }
 
     DeleteXi18nAtom(i18n_core);
+    if (i18n_core->trans_methods.end)
+        i18n_core->trans_methods.end (ims);
     if (!i18n_core->methods.end (ims))
         return False;
     
@@ -811,6 +859,7 @@ static Status xi18n_closeIM(XIMS ims)
     free (i18n_core->address.xim_attr);
     free (i18n_core->address.xic_attr);
     free (i18n_core->address.connect_addr);
+    free (i18n_core->address.trans_addr);
     free (i18n_core);
     return True;
 }
@@ -904,15 +953,46 @@ static void EventToWireEvent (XEvent *ev, xEvent *event, CARD16 *serial, Bool ne
     /*endswitch*/
 }
 
+/* Sends a key event back with XIM_EXT_FORWARD_KEYEVENT and the
+   synchronous flag off, so the client does not answer with
+   XIM_SYNC_REPLY and its next events are not queued meanwhile. */
+static Status ExtForwardEvent (XIMS ims, IMForwardEventStruct *call_data)
+{
+    Xi18n i18n_core = ims->protocol;
+    unsigned char *reply;
+    XKeyEvent *kev = (XKeyEvent *) &call_data->event;
+    int total_size;
+
+    reply = _Xi18nReserveMessage (ims, call_data->connect_id, 20);
+    if (reply == NULL)
+        return False;
+    /*endif*/
+    total_size = _Xi18nEncodeExtForwardKeyEvent (reply,
+                        _Xi18nNeedSwap (i18n_core, call_data->connect_id),
+                        call_data->connect_id,
+                        call_data->icid,
+                        0,
+                        (CARD16) (kev->serial & (unsigned long) 0xFFFF),
+                        (CARD8) kev->type,
+                        (CARD8) kev->keycode,
+                        (CARD16) kev->state,
+                        (CARD32) kev->time,
+                        (CARD32) kev->window);
+    _Xi18nCommitMessage (ims,
+                         call_data->connect_id,
+                         XIM_EXTENSION,
+                         XIM_EXT_FORWARD_KEYEVENT,
+                         total_size);
+
+    return True;
+}
+
 static Status xi18n_forwardEvent (XIMS ims, XPointer xp)
 {
     Xi18n i18n_core = ims->protocol;
     IMForwardEventStruct *call_data = (IMForwardEventStruct *)xp;
-    FrameMgr fm;
-    extern XimFrameRec forward_event_fr[];
     register int total_size;
-    unsigned char *reply = NULL;
-    unsigned char *replyp;
+    unsigned char *reply;
     CARD16 serial;
     int event_size;
     Xi18nClient *client;
@@ -920,51 +1000,51 @@ static Status xi18n_forwardEvent (XIMS ims, XPointer xp)
 
     client = (Xi18nClient *) _Xi18nFindClient (i18n_core, call_data->connect_id);
 
-    /* create FrameMgr */
-    need_swap = _Xi18nNeedSwap (i18n_core, call_data->connect_id);
-    fm = FrameMgrInit (forward_event_fr,
-                       NULL,
-                       need_swap);
-
-    total_size = FrameMgrGetTotalSize (fm);
-    event_size = sizeof (xEvent);
-    reply = (unsigned char *) malloc (total_size + event_size);
-    if (!reply)
+    /* The caller may ask for asynchronous forwarding by clearing
+       sync_bit. We only honor it for clients that negotiated
+       XIM_EXT_FORWARD_KEYEVENT, everyone else is always sync.
+       Xlib never queries that extension, so for its clients this is
+       always sync. */
+    if (call_data->sync_bit == 0  &&  client->ext_forward)
     {
-        _Xi18nSendMessage (ims,
-                           call_data->connect_id,
-                           XIM_ERROR,
-                           0,
-                           0,
-                           0);
-        return False;
+        if (call_data->event.type == KeyPress)
+            return ExtForwardEvent (ims, call_data);
+        /*endif*/
+    }
+    else
+    {
+        call_data->sync_bit = 1;
+        client->sync = True;
     }
     /*endif*/
-    memset (reply, 0, total_size + event_size);
-    FrameMgrSetBuffer (fm, reply);
-    replyp = reply;
 
-    call_data->sync_bit = 1; 	/* always sync */
-    client->sync = True;
-
-    FrameMgrPutToken (fm, call_data->connect_id);
-    FrameMgrPutToken (fm, call_data->icid);
-    FrameMgrPutToken (fm, call_data->sync_bit);
-
-    replyp += total_size;
-    EventToWireEvent (&(call_data->event), (xEvent *) replyp, &serial, need_swap);
-
-    FrameMgrPutToken (fm, serial);
-
-    _Xi18nSendMessage (ims,
-                       call_data->connect_id,
-                       XIM_FORWARD_EVENT,
-                       0,
-                       reply,
-                       total_size + event_size);
-
-    free (reply);
-    FrameMgrFree (fm);
+    need_swap = _Xi18nNeedSwap (i18n_core, call_data->connect_id);
+    /* forward_event_fr is 8 bytes, followed by the wire event */
+    total_size = 8;
+    event_size = sizeof (xEvent);
+    reply = _Xi18nReserveMessage (ims,
+                                  call_data->connect_id,
+                                  total_size + event_size);
+    if (reply == NULL)
+        return False;
+    /*endif*/
+    memset (reply + total_size, 0, event_size);
+    EventToWireEvent (&(call_data->event),
+                      (xEvent *) (reply + total_size),
+                      &serial,
+                      need_swap);
+    _Xi18nEncodeForwardEvent (reply,
+                              need_swap,
+                              call_data->connect_id,
+                              call_data->icid,
+                              call_data->sync_bit,
+                              serial);
+
+    _Xi18nCommitMessage (ims,
+                         call_data->connect_id,
+                         XIM_FORWARD_EVENT,
+                         0,
+                         total_size + event_size);
 
     return True;
 }
@@ -974,7 +1054,6 @@ static Status xi18n_commit (XIMS ims, XPointer xp)
     Xi18n i18n_core = ims->protocol;
     IMCommitStruct *call_data = (IMCommitStruct *)xp;
     FrameMgr fm;
-    extern XimFrameRec commit_chars_fr[];
     extern XimFrameRec commit_both_fr[];
     register int total_size;
     unsigned char *reply = NULL;
@@ -986,35 +1065,26 @@ static Status xi18n_commit (XIMS ims, XPointer xp)
         &&
         (call_data->flag & XimLookupChars))
     {
-        fm = FrameMgrInit (commit_chars_fr,
-                           NULL,
-                           _Xi18nNeedSwap (i18n_core, call_data->connect_id));
-
-        /* set length of STRING8 */
         str_length = strlen (call_data->commit_string);
-        FrameMgrSetSize (fm, str_length);
-        total_size = FrameMgrGetTotalSize (fm);
-        reply = (unsigned char *) malloc (total_size);
-        if (!reply)
-        {
-            _Xi18nSendMessage (ims,
-                               call_data->connect_id,
-                               XIM_ERROR,
-                               0,
-                               0,
-                               0);
+        total_size = _Xi18nCommitCharsSize (str_length);
+        reply = _Xi18nReserveMessage (ims, call_data->connect_id, total_size);
+        if (reply == NULL)
             return False;
-        }
         /*endif*/
-        memset (reply, 0, total_size);
-        FrameMgrSetBuffer (fm, reply);
-
-        str_length = FrameMgrGetSize (fm);
-        FrameMgrPutToken (fm, call_data->connect_id);
-        FrameMgrPutToken (fm, call_data->icid);
-        FrameMgrPutToken (fm, call_data->flag);
-        FrameMgrPutToken (fm, str_length);
-        FrameMgrPutToken (fm, call_data->commit_string);
+        _Xi18nEncodeCommitChars (reply,
+                                 _Xi18nNeedSwap (i18n_core,
+                                                 call_data->connect_id),
+                                 call_data->connect_id,
+                                 call_data->icid,
+                                 call_data->flag,
+                                 call_data->commit_string,
+                                 str_length);
+        _Xi18nCommitMessage (ims,
+                             call_data->connect_id,
+                             XIM_COMMIT,
+                             0,
+                             total_size);
+        return True;
     }
     else
     {
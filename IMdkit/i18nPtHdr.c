@@ -41,6 +41,7 @@ extern void DebugLog(int deflevel, int inplevel, char *fmt, ...);
 #include "../src/debug.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <sys/param.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
@@ -64,14 +65,10 @@ static void DiscardQueue (XIMS ims, CARD16 connect_id)
 
     if (client != NULL) {
 	client->sync = False;
-	while (client->pending != NULL) {
-	    XIMPending* pending = client->pending;
-
-	    client->pending = pending->next;
-
-	    XFree(pending->p);
-	    XFree(pending);
-	}
+	_Xi18nEndWait (i18n_core, client);
+	client->pending_head = 0;
+	client->pending_count = 0;
+	memset (client->dropped_keys, 0, sizeof (client->dropped_keys));
     }
 }
 
@@ -170,6 +167,7 @@ static void DisConnectMessageProc (XIMS ims, IMProtocol *call_data)
     Xi18n i18n_core = ims->protocol;
     unsigned char *reply = NULL;
     CARD16 connect_id = call_data->any.connect_id;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
 
 #ifdef PROTOCOL_RICH
     if (i18n_core->address.improto)
@@ -188,7 +186,7 @@ static void DisConnectMessageProc (XIMS ims, IMProtocol *call_data)
                        reply,
                        0);
 
-    i18n_core->methods.disconnect (ims, connect_id);
+    client->methods->disconnect (ims, connect_id);
 }
 
 static void OpenMessageProc(XIMS ims, IMProtocol *call_data, unsigned char *p)
@@ -556,6 +554,28 @@ static void QueryExtensionMessageProc (XIMS ims,
 
     FrameMgrPutToken (fm, input_method_ID);
 
+    /* A client that names XIM_EXT_FORWARD_KEYEVENT explicitly can take
+       forwarded key events asynchronously, see xi18n_forwardEvent().
+       Xlib asks for no extension by name, only other XIM libraries
+       could. */
+    if (number > 0)
+    {
+        Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+
+        for (i = 0;  i < reply_number;  i++)
+        {
+            if (ext_list[i].major_opcode == XIM_EXTENSION
+                &&
+                ext_list[i].minor_opcode == XIM_EXT_FORWARD_KEYEVENT)
+            {
+                client->ext_forward = True;
+            }
+            /*endif*/
+        }
+        /*endfor*/
+    }
+    /*endif*/
+
     for (i = 0;  i < reply_number;  i++)
     {
         str_size = FrameMgrGetSize (fm);
@@ -585,20 +605,16 @@ static void SyncReplyMessageProc (XIMS ims,
                                   unsigned char *p)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    extern XimFrameRec sync_reply_fr[];
     CARD16 connect_id = call_data->any.connect_id;
     Xi18nClient *client;
     CARD16 input_method_ID;
     CARD16 input_context_ID;
 
     client = (Xi18nClient *)_Xi18nFindClient (i18n_core, connect_id);
-    fm = FrameMgrInit (sync_reply_fr,
-                       (char *) p,
-                       _Xi18nNeedSwap (i18n_core, connect_id));
-    FrameMgrGetToken (fm, input_method_ID);
-    FrameMgrGetToken (fm, input_context_ID);
-    FrameMgrFree (fm);
+    _Xi18nDecodeSyncReply (p,
+                           _Xi18nNeedSwap (i18n_core, connect_id),
+                           &input_method_ID,
+                           &input_context_ID);
 
     client->sync = False;
 
@@ -1275,8 +1291,6 @@ static void ForwardEventMessageProc (XIMS ims,
                                      unsigned char *p)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    extern XimFrameRec forward_event_fr[];
     xEvent wire_event;
     IMForwardEventStruct *forward =
         (IMForwardEventStruct*) &call_data->forwardevent;
@@ -1285,19 +1299,15 @@ static void ForwardEventMessageProc (XIMS ims,
     Bool need_swap;
 
     need_swap = _Xi18nNeedSwap (i18n_core, connect_id);
-    fm = FrameMgrInit (forward_event_fr,
-                       (char *) p,
-                       need_swap);
     /* get data */
-    FrameMgrGetToken (fm, input_method_ID);
-    FrameMgrGetToken (fm, forward->icid);
-    FrameMgrGetToken (fm, forward->sync_bit);
-    FrameMgrGetToken (fm, forward->serial_number);
-    p += sizeof (CARD16)*4;
+    p += _Xi18nDecodeForwardEvent (p,
+                                   need_swap,
+                                   &input_method_ID,
+                                   &forward->icid,
+                                   &forward->sync_bit,
+                                   &forward->serial_number);
     memmove (&wire_event, p, sizeof (xEvent));
 
-    FrameMgrFree (fm);
-
     if (WireEventToEvent (i18n_core,
                           &wire_event,
                           forward->serial_number,
@@ -1383,23 +1393,16 @@ static void ExtMoveMessageProc (XIMS ims,
                                 unsigned char *p)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    extern XimFrameRec ext_move_fr[];
     IMMoveStruct *extmove =
         (IMMoveStruct*) & call_data->extmove;
     CARD16 connect_id = call_data->any.connect_id;
-    CARD16 input_method_ID;
-
-    fm = FrameMgrInit (ext_move_fr,
-                       (char *) p,
-                       _Xi18nNeedSwap (i18n_core, connect_id));
-    /* get data */
-    FrameMgrGetToken (fm, input_method_ID);
-    FrameMgrGetToken (fm, extmove->icid);
-    FrameMgrGetToken (fm, extmove->x);
-    FrameMgrGetToken (fm, extmove->y);
+    int need_swap = _Xi18nNeedSwap (i18n_core, connect_id);
 
-    FrameMgrFree (fm);
+    /* ext_move_fr: input method id, ic id, x, y; it comes on every caret
+       move, so read it without a FrameMgr */
+    extmove->icid = _Xi18nDecodeCard16 (p + 2, need_swap);
+    extmove->x = _Xi18nDecodeCard16 (p + 4, need_swap);
+    extmove->y = _Xi18nDecodeCard16 (p + 6, need_swap);
 
     if (i18n_core->address.improto)
     {
@@ -1521,13 +1524,15 @@ static void TriggerNotifyMessageProc (XIMS ims,
     free (reply);
 }
 
+/* Picks the first encoding of our list, which is in the order of
+   preference, that the client also offers. Returns an index into the
+   client's list, or XIM_Default_Encoding_IDX for COMPOUND_TEXT. */
 static INT16 ChooseEncoding (Xi18n i18n_core,
                              IMEncodingNegotiationStruct *enc_nego)
 {
     Xi18nAddressRec *address = (Xi18nAddressRec *) & i18n_core->address;
     XIMEncodings *p;
     int i, j;
-    int enc_index=0;
 
     p = (XIMEncodings *) &address->encoding_list;
     for (i = 0;  i < (int) p->count_encodings;  i++)
@@ -1536,20 +1541,14 @@ static INT16 ChooseEncoding (Xi18n i18n_core,
         {
             if (strcmp (p->supported_encodings[i],
                         enc_nego->encoding[j].name) == 0)
-            {
-                enc_index = j;
-                break;
-            }
+                return (INT16) j;
             /*endif*/
         }
         /*endfor*/
     }
     /*endfor*/
 
-    return (INT16) enc_index;
-#if 0
     return (INT16) XIM_Default_Encoding_IDX;
-#endif
 }
 
 static void EncodingNegotiatonMessageProc (XIMS ims,
@@ -1568,6 +1567,7 @@ static void EncodingNegotiatonMessageProc (XIMS ims,
         (IMEncodingNegotiationStruct *) &call_data->encodingnego;
     CARD16 connect_id = call_data->any.connect_id;
     CARD16 input_method_ID;
+    Xi18nClient *client;
 
     fm = FrameMgrInit (encoding_negotiation_fr,
                        (char *) p,
@@ -1605,7 +1605,7 @@ static void EncodingNegotiatonMessageProc (XIMS ims,
     if (byte_length > 0)
     {
         enc_nego->encodinginfo = (XIMStr *) malloc (sizeof (XIMStr)*10);
-        memset (enc_nego->encoding, 0, sizeof (XIMStr)*10);
+        memset (enc_nego->encodinginfo, 0, sizeof (XIMStr)*10);
         i = 0;
         while (FrameMgrIsIterLoopEnd (fm, &status) == False)
         {
@@ -1629,15 +1629,20 @@ static void EncodingNegotiatonMessageProc (XIMS ims,
     enc_nego->enc_index = ChooseEncoding (i18n_core, enc_nego);
     enc_nego->category = 0;
 
-#ifdef PROTOCOL_RICH
-    if (i18n_core->address.improto)
+    client = _Xi18nFindClient (i18n_core, connect_id);
+    if (client != NULL)
     {
-        if (!(i18n_core->address.improto(ims, call_data)))
-            return;
-        /*endif*/
+        client->utf8 = enc_nego->enc_index >= 0
+                       &&  strcmp (enc_nego->encoding[enc_nego->enc_index].name,
+                                   "UTF8_STRING") == 0;
     }
     /*endif*/
-#endif  /* PROTOCOL_RICH */
+
+    /* let the server know which encoding the texts of this connection
+       are sent in */
+    if (i18n_core->address.improto)
+        i18n_core->address.improto (ims, call_data);
+    /*endif*/
 
     FrameMgrFree (fm);
 
@@ -1752,26 +1757,6 @@ void PreeditCaretReplyMessageProc (XIMS ims,
     /*endif*/
 }
 
-static char* ctstombs(Display* display, char* compound_text, size_t len)
-{
-    char **list = NULL;
-    char *ret = NULL;
-    int count = 0;
-    XTextProperty text_prop;
-
-    text_prop.value = (unsigned char*)compound_text;
-    text_prop.encoding = XInternAtom(display, "COMPOUND_TEXT", False);
-    text_prop.format = 8;
-    text_prop.nitems = len;
-
-    XmbTextPropertyToTextList(display, &text_prop, &list, &count);
-    if (list != NULL)
-	ret = strdup(list[0]);
-    XFreeStringList(list);
-
-    return ret;
-}
-
 void StrConvReplyMessageProc (XIMS ims,
                               IMProtocol *call_data,
                               unsigned char *p)
@@ -1785,6 +1770,7 @@ void StrConvReplyMessageProc (XIMS ims,
     CARD16 connect_id = call_data->any.connect_id;
     CARD16 input_method_ID;
     CARD16 length;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
     int i;
 
     fm = FrameMgrInit (str_conversion_reply_fr,
@@ -1803,9 +1789,18 @@ void StrConvReplyMessageProc (XIMS ims,
 	FrameMgrSetSize (fm, length);
 	FrameMgrGetToken (fm, str);
 
+	/* the text is passed to the server in UTF-8 */
 	text.encoding_is_wchar = False;
-	text.string.mbs = ctstombs(i18n_core->address.dpy, str, length);
-	text.length = strlen(text.string.mbs);
+	if (client != NULL && client->utf8) {
+	    text.string.mbs = strndup(str, length);
+	} else {
+	    int utf8_length = IMCompoundTextToUtf8(str, length, NULL, 0);
+	    text.string.mbs = malloc(utf8_length + 1);
+	    if (text.string.mbs != NULL)
+		IMCompoundTextToUtf8(str, length,
+				     text.string.mbs, utf8_length + 1);
+	}
+	text.length = text.string.mbs != NULL ? strlen(text.string.mbs) : 0;
 
 	FrameMgrGetToken (fm, feedback_length);
 	feedback_length /= sizeof(CARD32);
@@ -1836,43 +1831,245 @@ void StrConvReplyMessageProc (XIMS ims,
     return;
 }
 
-static void AddQueue (Xi18nClient *client, unsigned char *p)
+static int MessageSize (Xi18n i18n_core, CARD16 connect_id, unsigned char *p)
 {
-    XIMPending *new;
-    XIMPending *last;
+    XimProtoHdr *hdr = (XimProtoHdr *) p;
+    CARD16 length = hdr->length;
 
-    if ((new = (XIMPending *) malloc (sizeof (XIMPending))) == NULL)
-        return;
+    if (_Xi18nNeedSwap (i18n_core, connect_id))
+        length = ((length << 8) & 0xFF00) | ((length >> 8) & 0xFF);
     /*endif*/
-    new->p = p;
-    new->next = (XIMPending *) NULL;
-    if (!client->pending)
+    return sizeof (XimProtoHdr) + length*4;
+}
+
+/* Whether a message has to wait behind the events a client has not
+   answered XIM_SYNC_REPLY for yet. These are the key events and the
+   requests which need no reply, like XIM_EXT_MOVE. Xlib only answers
+   XIM_SYNC_REPLY once the application is back in its event loop, so a
+   request the client blocks on, like XIM_SET_IC_VALUES or XIM_RESET_IC,
+   can never wait for it. */
+static Bool IsQueuedMessage (unsigned char *p)
+{
+    XimProtoHdr *hdr = (XimProtoHdr *) p;
+
+    switch (hdr->major_opcode)
     {
-        client->pending = new;
+    case XIM_FORWARD_EVENT:
+        return True;
+
+    case XIM_EXTENSION:
+        return hdr->minor_opcode == XIM_EXT_FORWARD_KEYEVENT
+               ||
+               hdr->minor_opcode == XIM_EXT_MOVE;
+    }
+    /*endswitch*/
+    return False;
+}
+
+/* Points key to the bytes which tell a key event apart: type, keycode,
+   state and window. They are compared in client byte order. Messages
+   which are not key events, or too short for one, give False. */
+static Bool GetQueuedKey (Xi18n i18n_core,
+                          CARD16 connect_id,
+                          unsigned char *p,
+                          unsigned char key[8])
+{
+    XimProtoHdr *hdr = (XimProtoHdr *) p;
+    unsigned char *ev = (unsigned char *) (hdr + 1);
+    int size = MessageSize (i18n_core, connect_id, p);
+
+    if (hdr->major_opcode == XIM_FORWARD_EVENT)
+    {
+        /* 8 bytes of forward_event_fr, then an xEvent */
+        if (size < sizeof (XimProtoHdr) + 8 + 32)
+            return False;
+        /*endif*/
+        ev += 8;
+        key[0] = ev[0] & 0x7F;
+        key[1] = ev[1];
+        memcpy (key + 2, ev + 28, 2);	/* state */
+        memcpy (key + 4, ev + 12, 4);	/* event window */
+    }
+    else if (hdr->major_opcode == XIM_EXTENSION
+             &&
+             hdr->minor_opcode == XIM_EXT_FORWARD_KEYEVENT)
+    {
+        /* ext_forward_keyevent_fr */
+        if (size < sizeof (XimProtoHdr) + 20)
+            return False;
+        /*endif*/
+        key[0] = ev[8] & 0x7F;
+        key[1] = ev[9];
+        memcpy (key + 2, ev + 10, 2);
+        memcpy (key + 4, ev + 16, 4);
     }
     else
     {
-        for (last = client->pending;  last->next;  last = last->next)
-            ;
-        /*endfor*/
-        last->next = new;
+        /* XIM_EXT_MOVE and the like */
+        return False;
     }
     /*endif*/
-    return;
+    return key[0] == KeyPress  ||  key[0] == KeyRelease;
+}
+
+/* Auto-repeat shows up as the same press again, or as a press/release
+   pair repeating the last one, so look at the last two queued events. */
+static Bool IsRepeatedKey (Xi18n i18n_core,
+                           Xi18nClient *client,
+                           unsigned char *p)
+{
+    unsigned char key[8];
+    unsigned char queued[8];
+    int n;
+
+    if (!GetQueuedKey (i18n_core, client->connect_id, p, key))
+        return False;
+    /*endif*/
+    for (n = 1;  n <= 2  &&  n <= client->pending_count;  n++)
+    {
+        int i = (client->pending_head + client->pending_count - n)
+                % XIM_PENDING_MAX;
+
+        if (GetQueuedKey (i18n_core,
+                          client->connect_id,
+                          client->pending[i].p,
+                          queued)
+            &&
+            memcmp (key, queued, sizeof (key)) == 0)
+        {
+            return True;
+        }
+        /*endif*/
+    }
+    /*endfor*/
+    return False;
+}
+
+static void DropQueuedMessage (Xi18n i18n_core,
+                               Xi18nClient *client,
+                               const char *reason)
+{
+    i18n_core->address.stats.pending_dropped++;
+    nabi_log (4, "sync queue of cid %d: drop a message, %s\n",
+              client->connect_id, reason);
+}
+
+/* The message handler only borrows its packet, so a message put on the
+   pending queue is copied into the ring. Key presses are dropped first,
+   and a release goes the way of its press, so the client never sees a
+   key stuck down or released twice. */
+static void AddQueue (Xi18n i18n_core,
+                      Xi18nClient *client,
+                      unsigned char *p)
+{
+    XIMPending *pending;
+    unsigned char key[8];
+    int size = MessageSize (i18n_core, client->connect_id, p);
+
+    if (size > XIM_PENDING_MSG_SIZE)
+    {
+        DropQueuedMessage (i18n_core, client, "too long");
+        return;
+    }
+    /*endif*/
+    if (client->pending == NULL)
+    {
+        client->pending = (XIMPending *) malloc (sizeof (XIMPending)
+                                                 * XIM_PENDING_MAX);
+        if (client->pending == NULL)
+        {
+            DropQueuedMessage (i18n_core, client, "out of memory");
+            return;
+        }
+        /*endif*/
+        client->pending_head = 0;
+        client->pending_count = 0;
+    }
+    /*endif*/
+
+    if (GetQueuedKey (i18n_core, client->connect_id, p, key))
+    {
+        unsigned char bit = 1 << (key[1] & 7);
+        unsigned char *dropped = &client->dropped_keys[key[1] >> 3];
+
+        if (key[0] == KeyRelease)
+        {
+            if (*dropped & bit)
+            {
+                *dropped &= ~bit;
+                DropQueuedMessage (i18n_core, client, "its press was dropped");
+                return;
+            }
+            /*endif*/
+        }
+        else if (client->pending_count >= XIM_PENDING_MAX - XIM_PENDING_RESERVE
+                 ||
+                 (client->pending_count >= XIM_PENDING_COALESCE
+                  &&
+                  IsRepeatedKey (i18n_core, client, p)))
+        {
+            *dropped |= bit;
+            DropQueuedMessage (i18n_core, client, "the queue is full");
+            return;
+        }
+        /*endif*/
+    }
+    /*endif*/
+
+    if (client->pending_count >= XIM_PENDING_MAX)
+    {
+        DropQueuedMessage (i18n_core, client, "no room left");
+        return;
+    }
+    /*endif*/
+
+    pending = &client->pending[(client->pending_head + client->pending_count)
+                               % XIM_PENDING_MAX];
+    memmove (pending->p, p, size);
+    pending->time = _Xi18nTime ();
+    client->pending_count++;
+
+    if (client->pending_count > i18n_core->address.stats.max_pending)
+        i18n_core->address.stats.max_pending = client->pending_count;
+    /*endif*/
 }
 
 static void ProcessQueue (XIMS ims, CARD16 connect_id)
 {
     Xi18n i18n_core = ims->protocol;
+    Xi18nStats *stats = &i18n_core->address.stats;
     Xi18nClient *client = (Xi18nClient *) _Xi18nFindClient (i18n_core,
                                                             connect_id);
 
-    while (client->sync == False  &&  client->pending)
+    while (client != NULL
+           &&
+           client->sync == False
+           &&
+           client->waiting == False
+           &&
+           client->pending_count > 0)
     {
-        XimProtoHdr *hdr = (XimProtoHdr *) client->pending->p;
+        /* the handlers may queue or discard messages, or even drop the
+           client, so work on a copy of the slot */
+        unsigned char p[XIM_PENDING_MSG_SIZE];
+        XIMPending *pending = &client->pending[client->pending_head];
+        XimProtoHdr *hdr = (XimProtoHdr *) p;
         unsigned char *p1 = (unsigned char *) (hdr + 1);
         IMProtocol call_data;
+        unsigned long latency;
+
+        memcpy (p, pending->p, sizeof (p));
+        latency = _Xi18nTime () - pending->time;
+        client->pending_head = (client->pending_head + 1) % XIM_PENDING_MAX;
+        client->pending_count--;
+
+        stats->pending_processed++;
+        stats->pending_latency += latency;
+        if (latency > stats->max_pending_latency)
+            stats->max_pending_latency = latency;
+        /*endif*/
 
+        memset (&call_data, 0, sizeof (IMProtocol));
         call_data.major_code = hdr->major_opcode;
         call_data.any.minor_code = hdr->minor_opcode;
         call_data.any.connect_id = connect_id;
@@ -1882,36 +2079,121 @@ static void ProcessQueue (XIMS ims, CARD16 connect_id)
         case XIM_FORWARD_EVENT:
             ForwardEventMessageProc(ims, &call_data, p1);
             break;
+
+        case XIM_EXTENSION:
+            ExtensionMessageProc (ims, &call_data, p1);
+            break;
         }
         /*endswitch*/
-        XFree (hdr);
-        {
-            XIMPending *old = client->pending;
 
-            client->pending = old->next;
-            XFree (old);
-        }
+        client = (Xi18nClient *) _Xi18nFindClient (i18n_core, connect_id);
     }
     /*endwhile*/
     return;
 }
 
+/* Gives up on the reply the client owes us, and lets the messages held
+   behind it through. */
+static void ExpireWait (XIMS ims, Xi18nClient *client)
+{
+    Xi18n i18n_core = ims->protocol;
+
+    _Xi18nEndWait (i18n_core, client);
+    client->stalls++;
+    i18n_core->address.stats.wait_stalls++;
+    nabi_log (3, "cid %d did not answer %d:%d in time, stalls: %lu\n",
+              client->connect_id, client->wait_major, client->wait_minor,
+              client->stalls);
+    ProcessQueue (ims, client->connect_id);
+}
+
+long _Xi18nWaitTimeout (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = i18n_core->address.waiting_clients;
+    long timeout = -1;
+    long left;
+
+    /* output a client did not read yet is retried by _Xi18nExpireWaits */
+    if (i18n_core->address.blocked_clients > 0)
+        timeout = XIM_RETRY_INTERVAL;
+    /*endif*/
+
+    /* the first one runs out first */
+    if (client != NULL)
+    {
+        left = (long) (client->wait_deadline - _Xi18nTime ());
+        if (left <= 0)
+            return 0;
+        /*endif*/
+        if (timeout < 0  ||  left < timeout)
+            timeout = left;
+        /*endif*/
+    }
+    /*endif*/
+    return timeout;
+}
+
+/* A client which never answers may never send anything else either, so
+   the server calls this from its main loop when a wait runs out. The
+   flush at the end also retries output a client has not read yet. */
+void _Xi18nExpireWaits (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client;
+    unsigned long now = _Xi18nTime ();
+
+    _Xi18nCork (ims);
+    /* the held messages may drop clients, so look at the head again
+       after each */
+    while ((client = i18n_core->address.waiting_clients) != NULL
+           &&
+           (long) (now - client->wait_deadline) >= 0)
+    {
+        ExpireWait (ims, client);
+    }
+    /*endwhile*/
+    _Xi18nUncork (ims);
+}
 
+/* p is only valid during the call, it may point into an X event or a
+   buffer owned by Xlib. */
 void _Xi18nMessageHandler (XIMS ims,
                            CARD16 connect_id,
-                           unsigned char *p,
-                           Bool *delete)
+                           unsigned char *p)
 {
     XimProtoHdr	*hdr = (XimProtoHdr *)p;
     unsigned char *p1 = (unsigned char *)(hdr + 1);
     IMProtocol call_data;
     Xi18n i18n_core = ims->protocol;
     Xi18nClient *client;
+    Bool resumed = False;
 
     client = (Xi18nClient *) _Xi18nFindClient (i18n_core, connect_id);
     if (hdr == (XimProtoHdr *) NULL)
         return;
     /*endif*/
+
+    if (client != NULL  &&  client->waiting)
+    {
+        if ((hdr->major_opcode == client->wait_major
+             &&
+             hdr->minor_opcode == client->wait_minor)
+            ||
+            hdr->major_opcode == XIM_ERROR)
+        {
+            /* handle the reply first, then what was held behind it */
+            _Xi18nEndWait (i18n_core, client);
+            resumed = True;
+        }
+        else if ((long) (_Xi18nTime () - client->wait_deadline) >= 0)
+        {
+            ExpireWait (ims, client);
+            client = (Xi18nClient *) _Xi18nFindClient (i18n_core, connect_id);
+        }
+        /*endif*/
+    }
+    /*endif*/
     
     memset (&call_data, 0, sizeof(IMProtocol));
 
@@ -1919,6 +2201,8 @@ void _Xi18nMessageHandler (XIMS ims,
     call_data.any.minor_code = hdr->minor_opcode;
     call_data.any.connect_id = connect_id;
 
+    _Xi18nCork (ims);
+
     switch (call_data.major_code)
     {
     case XIM_CONNECT:
@@ -1988,11 +2272,10 @@ void _Xi18nMessageHandler (XIMS ims,
 
     case XIM_FORWARD_EVENT:
 	nabi_log(5, "XIM_FORWARD_EVENT: cid: %d\n", connect_id);
-        if (client->sync == True)
+        if (client->sync == True  ||  client->waiting)
         {
 	    nabi_log(6, "XIM_FORWARD_EVENT(cid=%x: sync, add to queue\n", connect_id);
-            AddQueue (client, p);
-            *delete = False;
+            AddQueue (i18n_core, client, p);
         }
         else
         {
@@ -2003,7 +2286,13 @@ void _Xi18nMessageHandler (XIMS ims,
 
     case XIM_EXTENSION:
 	nabi_log(5, "XIM_EXTENSION: cid: %d\n", connect_id);
-        ExtensionMessageProc (ims, &call_data, p1);
+        if ((client->sync == True  ||  client->waiting)
+            &&
+            IsQueuedMessage (p))
+            AddQueue (i18n_core, client, p);
+        else
+            ExtensionMessageProc (ims, &call_data, p1);
+        /*endif*/
         break;
 
     case XIM_SYNC:
@@ -2049,4 +2338,10 @@ void _Xi18nMessageHandler (XIMS ims,
 	break;
     }
     /*endswitch*/
+
+    if (resumed)
+        ProcessQueue (ims, connect_id);
+    /*endif*/
+
+    _Xi18nUncork (ims);
 }
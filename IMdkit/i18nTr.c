@@ -0,0 +1,631 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+/*
+ * local/ transport: XIM protocol over a Unix domain stream socket.
+ *
+ * Messages are exchanged as they are, a 4 byte header followed by
+ * the body, with no X ClientMessage or window property in between.
+ * The sockets are registered with Xlib as internal connections, so
+ * the main loop has to watch them with XAddConnectionWatch() and call
+ * XProcessInternalConnection() when they become readable.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <X11/Xlib.h>
+#include "FrameMgr.h"
+#include "IMdkit.h"
+#include "Xi18n.h"
+#include "Xi18nTr.h"
+#include "XimFunc.h"
+
+#include "../src/debug.h"
+
+extern Xi18nClient *_Xi18nFindClient(Xi18n, CARD16);
+extern Xi18nClient *_Xi18nNewClient(Xi18n);
+extern void _Xi18nDeleteClient(Xi18n, CARD16);
+extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *);
+extern int _Xi18nNeedSwap (Xi18n, CARD16);
+
+static void WaitTransListen (Display *, int, XPointer);
+static void WaitTransData (Display *, int, XPointer);
+static Bool TransDisconnect (XIMS, CARD16);
+
+/* fds are small and dense, like connect_ids */
+static Bool GrowFdTable (TransSpecRec *spec, int fd)
+{
+    Xi18nClient **table;
+    int size = spec->fd_table_size;
+
+    if (fd < size)
+        return True;
+    /*endif*/
+    if (size == 0)
+        size = 16;
+    /*endif*/
+    while (size <= fd)
+        size *= 2;
+    /*endwhile*/
+    table = (Xi18nClient **) realloc (spec->fd_table,
+                                      size * sizeof (Xi18nClient *));
+    if (table == NULL)
+        return False;
+    /*endif*/
+    memset (table + spec->fd_table_size,
+            0,
+            (size - spec->fd_table_size) * sizeof (Xi18nClient *));
+    spec->fd_table = table;
+    spec->fd_table_size = size;
+    return True;
+}
+
+static Xi18nClient *NewTransClient (Xi18n i18n_core, int fd)
+{
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+    Xi18nClient *client;
+    TransClient *tr_client;
+
+    if (!GrowFdTable (spec, fd))
+        return NULL;
+    /*endif*/
+
+    tr_client = (TransClient *) malloc (sizeof (TransClient));
+    if (tr_client == NULL)
+        return NULL;
+    /*endif*/
+    tr_client->buf = (unsigned char *) malloc (TRANS_READ_BUFSIZE);
+    if (tr_client->buf == NULL)
+    {
+        free (tr_client);
+        return NULL;
+    }
+    /*endif*/
+    tr_client->fd = fd;
+    tr_client->buf_len = 0;
+    tr_client->buf_size = TRANS_READ_BUFSIZE;
+    tr_client->out = NULL;
+    tr_client->out_len = 0;
+    tr_client->out_size = 0;
+    tr_client->blocked = False;
+    tr_client->dirty = False;
+    tr_client->dirty_next = NULL;
+
+    client = _Xi18nNewClient (i18n_core);
+    if (client == NULL)
+    {
+        free (tr_client->buf);
+        free (tr_client);
+        return NULL;
+    }
+    /*endif*/
+    client->trans_rec = tr_client;
+    client->methods = &i18n_core->trans_methods;
+    tr_client->connect_id = client->connect_id;
+    spec->fd_table[fd] = client;
+    return client;
+}
+
+static Xi18nClient *FindTransClient (Xi18n i18n_core, int fd)
+{
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+
+    if (fd >= 0  &&  fd < spec->fd_table_size)
+        return spec->fd_table[fd];
+    /*endif*/
+    return NULL;
+}
+
+/* Append whatever is readable on the socket to the client buffer.
+   Returns False on EOF or error. */
+static Bool ReadTransData (TransClient *tr_client)
+{
+    int n;
+
+    if (tr_client->buf_len == tr_client->buf_size)
+    {
+        int size = tr_client->buf_size * 2;
+        unsigned char *buf;
+
+        buf = (unsigned char *) realloc (tr_client->buf, size);
+        if (buf == NULL)
+            return False;
+        /*endif*/
+        tr_client->buf = buf;
+        tr_client->buf_size = size;
+    }
+    /*endif*/
+
+    do
+    {
+        n = read (tr_client->fd,
+                  tr_client->buf + tr_client->buf_len,
+                  tr_client->buf_size - tr_client->buf_len);
+    } while (n < 0  &&  errno == EINTR);
+    /*enddo*/
+
+    /* the socket is non-blocking, and may have nothing for us yet */
+    if (n < 0  &&  (errno == EAGAIN  ||  errno == EWOULDBLOCK))
+        return True;
+    /*endif*/
+    if (n <= 0)
+        return False;
+    /*endif*/
+    tr_client->buf_len += n;
+    return True;
+}
+
+/* Take one complete XIM message out of the client buffer.
+   Returns NULL if the message has not been received completely yet,
+   or on protocol error, in which case *error is set. */
+static unsigned char *ReadTransMessage (Xi18n i18n_core,
+                                        Xi18nClient *client,
+                                        Bool *error)
+{
+    TransClient *tr_client = (TransClient *) client->trans_rec;
+    XimProtoHdr *hdr = (XimProtoHdr *) tr_client->buf;
+    unsigned char *rec = (unsigned char *) (hdr + 1);
+    FrameMgr fm;
+    extern XimFrameRec packet_header_fr[];
+    int total_size;
+    int message_size;
+    CARD8 major_opcode;
+    CARD8 minor_opcode;
+    CARD16 length;
+    unsigned char *p;
+
+    *error = False;
+    if (tr_client->buf_len < (int) sizeof (XimProtoHdr))
+        return NULL;
+    /*endif*/
+
+    if (client->byte_order == '?')
+    {
+        if (hdr->major_opcode != XIM_CONNECT)
+        {
+            *error = True;
+            return NULL;
+        }
+        /*endif*/
+        if (tr_client->buf_len < (int) sizeof (XimProtoHdr) + 1)
+            return NULL;
+        /*endif*/
+        client->byte_order = (CARD8) rec[0];
+    }
+    /*endif*/
+
+    fm = FrameMgrInit (packet_header_fr,
+                       (char *) hdr,
+                       _Xi18nNeedSwap (i18n_core, client->connect_id));
+    total_size = FrameMgrGetTotalSize (fm);
+    FrameMgrGetToken (fm, major_opcode);
+    FrameMgrGetToken (fm, minor_opcode);
+    FrameMgrGetToken (fm, length);
+    FrameMgrFree (fm);
+
+    message_size = total_size + length * 4;
+    if (tr_client->buf_len < message_size)
+        return NULL;
+    /*endif*/
+
+    if ((p = (unsigned char *) malloc (message_size)) == NULL)
+    {
+        *error = True;
+        return NULL;
+    }
+    /*endif*/
+
+    /* the rest of buf is moved down below, so the message is copied
+       out before it is handled */
+    memmove (p, tr_client->buf, message_size);
+
+    tr_client->buf_len -= message_size;
+    memmove (tr_client->buf,
+             tr_client->buf + message_size,
+             tr_client->buf_len);
+    return p;
+}
+
+static Bool TransBegin (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+    struct sockaddr_un addr;
+    int fd;
+
+    if (strlen (spec->path) >= sizeof (addr.sun_path))
+        return False;
+    /*endif*/
+
+    mkdir (XIM_LOCAL_DIR, 01777);
+    chmod (XIM_LOCAL_DIR, 01777);
+
+    fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return False;
+    /*endif*/
+    fcntl (fd, F_SETFD, FD_CLOEXEC);
+
+    memset (&addr, 0, sizeof (addr));
+    addr.sun_family = AF_UNIX;
+    strcpy (addr.sun_path, spec->path);
+
+    /* remove a stale socket left by a previous instance */
+    unlink (spec->path);
+    if (bind (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0
+        ||
+        listen (fd, 5) < 0)
+    {
+        nabi_log(1, "local transport: can't listen on %s: %s\n",
+                 spec->path, strerror (errno));
+        close (fd);
+        return False;
+    }
+    /*endif*/
+
+    spec->fd = fd;
+    _XRegisterInternalConnection (i18n_core->address.dpy,
+                                  fd,
+                                  WaitTransListen,
+                                  (XPointer) ims);
+    nabi_log(3, "local transport: listening on %s\n", spec->path);
+    return True;
+}
+
+static Bool TransEnd (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+
+    if (spec->fd >= 0)
+    {
+        _XUnregisterInternalConnection (i18n_core->address.dpy, spec->fd);
+        close (spec->fd);
+        unlink (spec->path);
+        spec->fd = -1;
+    }
+    /*endif*/
+    free (spec->path);
+    spec->path = NULL;
+    spec->dirty = NULL;
+    free (spec->fd_table);
+    spec->fd_table = NULL;
+    spec->fd_table_size = 0;
+    return True;
+}
+
+static void SetTransBlocked (Xi18n i18n_core,
+                             TransClient *tr_client,
+                             Bool blocked)
+{
+    if (tr_client->blocked == blocked)
+        return;
+    /*endif*/
+    tr_client->blocked = blocked;
+    if (blocked)
+        i18n_core->address.blocked_clients++;
+    else
+        i18n_core->address.blocked_clients--;
+    /*endif*/
+}
+
+/* Writes as much of the queued output as the socket takes. The rest
+   stays queued for the next flush, so a client which does not read its
+   socket can not block the server. */
+static Bool WriteTransData (Xi18n i18n_core,
+                            CARD16 connect_id,
+                            TransClient *tr_client)
+{
+    int written = 0;
+    int n;
+
+    while (written < tr_client->out_len)
+    {
+        n = write (tr_client->fd,
+                   tr_client->out + written,
+                   tr_client->out_len - written);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            /*endif*/
+            if (errno == EAGAIN  ||  errno == EWOULDBLOCK)
+                break;
+            /*endif*/
+            nabi_log(1, "local transport: write error on cid %d: %s\n",
+                     connect_id, strerror (errno));
+            tr_client->out_len = 0;
+            SetTransBlocked (i18n_core, tr_client, False);
+            return False;
+        }
+        /*endif*/
+        written += n;
+    }
+    /*endwhile*/
+
+    tr_client->out_len -= written;
+    memmove (tr_client->out, tr_client->out + written, tr_client->out_len);
+    SetTransBlocked (i18n_core, tr_client, tr_client->out_len > 0);
+    return True;
+}
+
+/* messages are only queued here, TransFlush writes them out */
+static Bool TransSend (XIMS ims,
+                       CARD16 connect_id,
+                       unsigned char *reply,
+                       long length)
+{
+    Xi18n i18n_core = ims->protocol;
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    TransClient *tr_client;
+
+    if (client == NULL)
+        return False;
+    /*endif*/
+    tr_client = (TransClient *) client->trans_rec;
+
+    if (tr_client->out_len + length > tr_client->out_size)
+    {
+        int size = tr_client->out_size > 0 ? tr_client->out_size
+                                           : TRANS_READ_BUFSIZE;
+        unsigned char *out;
+
+        while (size < tr_client->out_len + length)
+            size *= 2;
+        /*endwhile*/
+        out = (unsigned char *) realloc (tr_client->out, size);
+        if (out == NULL)
+            return False;
+        /*endif*/
+        tr_client->out = out;
+        tr_client->out_size = size;
+    }
+    /*endif*/
+    memmove (tr_client->out + tr_client->out_len, reply, length);
+    tr_client->out_len += length;
+    if (!tr_client->dirty)
+    {
+        tr_client->dirty = True;
+        tr_client->dirty_next = spec->dirty;
+        spec->dirty = tr_client;
+    }
+    /*endif*/
+    return True;
+}
+
+static void RemoveTransDirty (TransSpecRec *spec, TransClient *tr_client)
+{
+    TransClient **p;
+
+    if (!tr_client->dirty)
+        return;
+    /*endif*/
+    for (p = &spec->dirty;  *p != NULL;  p = &(*p)->dirty_next)
+    {
+        if (*p == tr_client)
+        {
+            *p = tr_client->dirty_next;
+            break;
+        }
+        /*endif*/
+    }
+    /*endfor*/
+    tr_client->dirty = False;
+    tr_client->dirty_next = NULL;
+}
+
+/* A client whose socket does not take all of its output stays on the
+   dirty list, the next flush tries again */
+static Bool TransFlush (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    TransSpecRec *spec = (TransSpecRec *) i18n_core->address.trans_addr;
+    TransClient **p = &spec->dirty;
+    TransClient *tr_client;
+
+    while ((tr_client = *p) != NULL)
+    {
+        WriteTransData (i18n_core, tr_client->connect_id, tr_client);
+        i18n_core->address.stats.packets++;
+        if (tr_client->out_len > 0)
+        {
+            p = &tr_client->dirty_next;
+        }
+        else
+        {
+            *p = tr_client->dirty_next;
+            tr_client->dirty = False;
+            tr_client->dirty_next = NULL;
+        }
+        /*endif*/
+    }
+    /*endwhile*/
+    return True;
+}
+
+static Bool TransDisconnect (XIMS ims, CARD16 connect_id)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    TransSpecRec *spec;
+    TransClient *tr_client;
+
+    if (client == NULL)
+        return False;
+    /*endif*/
+    tr_client = (TransClient *) client->trans_rec;
+
+    /* XIM_DISCONNECT_REPLY may still be queued, what the socket does not
+       take now is lost */
+    if (tr_client->out_len > 0)
+        WriteTransData (i18n_core, connect_id, tr_client);
+    /*endif*/
+    SetTransBlocked (i18n_core, tr_client, False);
+
+    spec = (TransSpecRec *) i18n_core->address.trans_addr;
+    RemoveTransDirty (spec, tr_client);
+    if (tr_client->fd < spec->fd_table_size)
+        spec->fd_table[tr_client->fd] = NULL;
+    /*endif*/
+    _XUnregisterInternalConnection (i18n_core->address.dpy, tr_client->fd);
+    close (tr_client->fd);
+    free (tr_client->out);
+    free (tr_client->buf);
+    free (tr_client);
+    _Xi18nDeleteClient (i18n_core, connect_id);
+    return True;
+}
+
+/* address is "hostname:path", hostname is not used since the
+   connection never leaves this machine */
+Bool _Xi18nCheckTransAddress (Xi18n i18n_core,
+                              TransportSW *transSW,
+                              char *address)
+{
+    TransSpecRec *spec;
+    char *path;
+    char *end;
+
+    path = strchr (address, ':');
+    if (path == NULL)
+        return False;
+    /*endif*/
+    path++;
+
+    end = strchr (path, ',');
+    if (end == NULL)
+        end = path + strlen (path);
+    /*endif*/
+    if (end == path)
+        return False;
+    /*endif*/
+
+    if (!(spec = (TransSpecRec *) malloc (sizeof (TransSpecRec))))
+        return False;
+    /*endif*/
+    spec->fd = -1;
+    spec->fd_table = NULL;
+    spec->fd_table_size = 0;
+    spec->dirty = NULL;
+    spec->path = (char *) malloc (end - path + 1);
+    if (spec->path == NULL)
+    {
+        free (spec);
+        return False;
+    }
+    /*endif*/
+    memcpy (spec->path, path, end - path);
+    spec->path[end - path] = '\0';
+
+    i18n_core->address.trans_addr = (TransSpecRec *) spec;
+    i18n_core->trans_methods.begin = TransBegin;
+    i18n_core->trans_methods.end = TransEnd;
+    i18n_core->trans_methods.send = TransSend;
+    i18n_core->trans_methods.wait = _Xi18nWaitReply;
+    i18n_core->trans_methods.disconnect = TransDisconnect;
+    i18n_core->trans_methods.flush = TransFlush;
+    return True;
+}
+
+static void WaitTransListen (Display *dpy, int fd, XPointer client_data)
+{
+    XIMS ims = (XIMS) client_data;
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client;
+    int new_fd;
+
+    do
+    {
+        new_fd = accept (fd, NULL, NULL);
+    } while (new_fd < 0  &&  errno == EINTR);
+    /*enddo*/
+    if (new_fd < 0)
+        return;
+    /*endif*/
+    fcntl (new_fd, F_SETFD, FD_CLOEXEC);
+    fcntl (new_fd, F_SETFL, fcntl (new_fd, F_GETFL) | O_NONBLOCK);
+
+    client = NewTransClient (i18n_core, new_fd);
+    if (client == NULL)
+    {
+        close (new_fd);
+        return;
+    }
+    /*endif*/
+
+    _XRegisterInternalConnection (dpy,
+                                  new_fd,
+                                  WaitTransData,
+                                  (XPointer) ims);
+    nabi_log(3, "local transport: new client: cid %d\n", client->connect_id);
+}
+
+static void WaitTransData (Display *dpy, int fd, XPointer client_data)
+{
+    XIMS ims = (XIMS) client_data;
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = FindTransClient (i18n_core, fd);
+    unsigned char *packet;
+    CARD16 connect_id;
+    Bool error;
+
+    if (client == NULL)
+        return;
+    /*endif*/
+    connect_id = client->connect_id;
+
+    if (!ReadTransData ((TransClient *) client->trans_rec))
+    {
+        nabi_log(3, "local transport: client closed: cid %d\n", connect_id);
+        TransDisconnect (ims, connect_id);
+        return;
+    }
+    /*endif*/
+
+    for (;;)
+    {
+        packet = ReadTransMessage (i18n_core, client, &error);
+        if (packet == NULL)
+            break;
+        /*endif*/
+        _Xi18nMessageHandler (ims, connect_id, packet);
+        free (packet);
+
+        /* the client may have been disconnected by XIM_DISCONNECT */
+        client = _Xi18nFindClient (i18n_core, connect_id);
+        if (client == NULL)
+            return;
+        /*endif*/
+    }
+    /*endfor*/
+
+    if (error)
+    {
+        nabi_log(1, "local transport: protocol error: cid %d\n", connect_id);
+        TransDisconnect (ims, connect_id);
+    }
+    /*endif*/
+}
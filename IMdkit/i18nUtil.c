@@ -29,6 +29,7 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  
 ******************************************************************/
 
+#include <sys/time.h>
 #include <X11/Xlib.h>
 #include "IMdkit.h"
 #include "Xi18n.h"
@@ -46,9 +47,39 @@ _Xi18nNeedSwap (Xi18n i18n_core, CARD16 connect_id)
     return (client->byte_order != im_byteOrder);
 }
 
+/* connect_ids are handed out densely and recycled through the free
+   list, so a plain array indexed by connect_id stays small */
+static Bool GrowClientTable (Xi18n i18n_core, int connect_id)
+{
+    Xi18nClient **table;
+    int size = i18n_core->address.client_table_size;
+
+    if (connect_id < size)
+        return True;
+    /*endif*/
+    if (size == 0)
+        size = 16;
+    /*endif*/
+    while (size <= connect_id)
+        size *= 2;
+    /*endwhile*/
+    table = (Xi18nClient **) realloc (i18n_core->address.client_table,
+                                      size * sizeof (Xi18nClient *));
+    if (table == NULL)
+        return False;
+    /*endif*/
+    memset (table + i18n_core->address.client_table_size,
+            0,
+            (size - i18n_core->address.client_table_size)
+            * sizeof (Xi18nClient *));
+    i18n_core->address.client_table = table;
+    i18n_core->address.client_table_size = size;
+    return True;
+}
+
+/* Returns NULL when out of memory */
 Xi18nClient *_Xi18nNewClient(Xi18n i18n_core)
 {
-    static CARD16 connect_id = 0;
     int new_connect_id;
     Xi18nClient *client;
 
@@ -61,7 +92,17 @@ Xi18nClient *_Xi18nNewClient(Xi18n i18n_core)
     else
     {
         client = (Xi18nClient *) malloc (sizeof (Xi18nClient));
-	new_connect_id = ++connect_id;
+        if (client == NULL)
+            return NULL;
+        /*endif*/
+	new_connect_id = ++i18n_core->address.last_connect_id;
+    }
+    /*endif*/
+    if (!GrowClientTable (i18n_core, new_connect_id))
+    {
+        /* _Xi18nFindClient() could never find it */
+        free (client);
+        return NULL;
     }
     /*endif*/
     memset (client, 0, sizeof (Xi18nClient));
@@ -69,25 +110,20 @@ Xi18nClient *_Xi18nNewClient(Xi18n i18n_core)
     client->pending = (XIMPending *) NULL;
     client->sync = False;
     client->byte_order = '?'; 	/* initial value */
+    client->methods = &i18n_core->methods;
     memset (&client->pending, 0, sizeof (XIMPending *));
     client->next = i18n_core->address.clients;
     i18n_core->address.clients = client;
+    i18n_core->address.client_table[new_connect_id] = client;
 
     return (Xi18nClient *) client;
 }
 
 Xi18nClient *_Xi18nFindClient (Xi18n i18n_core, CARD16 connect_id)
 {
-    Xi18nClient *client = i18n_core->address.clients;
-
-    while (client)
-    {
-        if (client->connect_id == connect_id)
-            return client;
-        /*endif*/
-        client = client->next;
-    }
-    /*endwhile*/
+    if (connect_id < i18n_core->address.client_table_size)
+        return i18n_core->address.client_table[connect_id];
+    /*endif*/
     return NULL;
 }
 
@@ -97,6 +133,12 @@ void _Xi18nDeleteClient (Xi18n i18n_core, CARD16 connect_id)
     Xi18nClient *ccp;
     Xi18nClient *ccp0;
 
+    if (target == NULL)
+        return;
+    /*endif*/
+    i18n_core->address.client_table[connect_id] = NULL;
+    _Xi18nEndWait (i18n_core, target);
+
     for (ccp = i18n_core->address.clients, ccp0 = NULL;
          ccp != NULL;
          ccp0 = ccp, ccp = ccp->next)
@@ -108,6 +150,12 @@ void _Xi18nDeleteClient (Xi18n i18n_core, CARD16 connect_id)
             else
                 ccp0->next = ccp->next;
             /*endif*/
+            free (target->out_buf);
+            target->out_buf = NULL;
+            target->out_buf_size = 0;
+            free (target->pending);
+            target->pending = NULL;
+            target->pending_count = 0;
             /* put it back to free list */
             target->next = i18n_core->address.free_clients;
             i18n_core->address.free_clients = target;
@@ -125,10 +173,17 @@ void _Xi18nDeleteAllClients (Xi18n i18n_core)
     while (client != NULL) {
 	Xi18nClient* tmp = client;
         client = client->next;
+	free (tmp->out_buf);
+	free (tmp->pending);
 	free (tmp);
     }
 
     i18n_core->address.clients = NULL;
+    i18n_core->address.waiting_clients = NULL;
+
+    free (i18n_core->address.client_table);
+    i18n_core->address.client_table = NULL;
+    i18n_core->address.client_table_size = 0;
 }
 
 void _Xi18nDeleteFreeClients (Xi18n i18n_core)
@@ -144,54 +199,211 @@ void _Xi18nDeleteFreeClients (Xi18n i18n_core)
     i18n_core->address.free_clients = NULL;
 }
 
+/* Returns room for a message body of the given length in the output
+   buffer of the client, right after the 4 byte packet header. The body
+   is sent by _Xi18nCommitMessage(), and the pointer is only good until
+   the next message to the same client. */
+unsigned char *_Xi18nReserveMessage (XIMS ims,
+                                     CARD16 connect_id,
+                                     long length)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    int size;
+
+    if (client == NULL)
+        return NULL;
+    /*endif*/
+
+    size = XIM_HEADER_SIZE + length;
+    if (size > client->out_buf_size)
+    {
+        unsigned char *buf;
+        int new_size = client->out_buf_size > 0 ? client->out_buf_size : 64;
+
+        while (new_size < size)
+            new_size *= 2;
+        /*endwhile*/
+        buf = (unsigned char *) realloc (client->out_buf, new_size);
+        if (buf == NULL)
+            return NULL;
+        /*endif*/
+        client->out_buf = buf;
+        client->out_buf_size = new_size;
+    }
+    /*endif*/
+    return client->out_buf + XIM_HEADER_SIZE;
+}
+
 void _Xi18nSendMessage (XIMS ims,
                         CARD16 connect_id,
                         CARD8 major_opcode,
                         CARD8 minor_opcode,
                         unsigned char *data,
                         long length)
+{
+    unsigned char *body;
+
+    body = _Xi18nReserveMessage (ims, connect_id, length);
+    if (body == NULL)
+        return;
+    /*endif*/
+    if (length > 0)
+        memmove (body, data, length);
+    /*endif*/
+    _Xi18nCommitMessage (ims, connect_id, major_opcode, minor_opcode, length);
+}
+
+/* Puts the packet header in front of the body written to the room
+   _Xi18nReserveMessage() returned and hands the message to the
+   transport. */
+void _Xi18nCommitMessage (XIMS ims,
+                          CARD16 connect_id,
+                          CARD8 major_opcode,
+                          CARD8 minor_opcode,
+                          long length)
 {
     Xi18n i18n_core = ims->protocol;
-    FrameMgr fm;
-    extern XimFrameRec packet_header_fr[];
-    unsigned char *reply_hdr = NULL;
-    int header_size;
-    unsigned char *reply = NULL;
-    unsigned char *replyp;
-    int reply_length;
-    long p_len = length/4;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    CARD16 p_len = (CARD16) (length/4);
+    unsigned char *reply;
 
-    fm = FrameMgrInit (packet_header_fr,
-                       NULL,
-                       _Xi18nNeedSwap (i18n_core, connect_id));
+    if (client == NULL  ||  client->out_buf == NULL)
+        return;
+    /*endif*/
 
-    header_size = FrameMgrGetTotalSize (fm);
-    reply_hdr = (unsigned char *) malloc (header_size);
-    if (reply_hdr == NULL)
+    reply = client->out_buf;
+    reply[0] = major_opcode;
+    reply[1] = minor_opcode;
+    if (_Xi18nNeedSwap (i18n_core, connect_id))
+        p_len = (CARD16) (((p_len << 8) & 0xFF00) | ((p_len >> 8) & 0xFF));
+    /*endif*/
+    memcpy (reply + 2, &p_len, sizeof (CARD16));
+
+    client->methods->send (ims, connect_id, reply, XIM_HEADER_SIZE + length);
+
+    i18n_core->address.stats.messages++;
+    i18n_core->address.stats.queue_depth++;
+    if (i18n_core->address.stats.queue_depth
+        > i18n_core->address.stats.max_queue_depth)
     {
-        _Xi18nSendMessage (ims, connect_id, XIM_ERROR, 0, 0, 0);
-        return;
+        i18n_core->address.stats.max_queue_depth =
+            i18n_core->address.stats.queue_depth;
     }
     /*endif*/
-    FrameMgrSetBuffer (fm, reply_hdr);
+    if (i18n_core->address.cork == 0)
+        _Xi18nFlush (ims);
+    /*endif*/
+}
 
-    /* put data */
-    FrameMgrPutToken (fm, major_opcode);
-    FrameMgrPutToken (fm, minor_opcode);
-    FrameMgrPutToken (fm, p_len);
+unsigned long _Xi18nTime (void)
+{
+    struct timeval tv;
 
-    reply_length = header_size + length;
-    reply = (unsigned char *) malloc (reply_length);
-    replyp = reply;
-    memmove (reply, reply_hdr, header_size);
-    replyp += header_size;
-    memmove (replyp, data, length);
+    gettimeofday (&tv, NULL);
+    return (unsigned long) tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
 
-    i18n_core->methods.send (ims, connect_id, reply, reply_length);
+/* The wait method of both transports. Instead of blocking until the
+   client answers, which would stop every other client and the whole
+   main loop of the server, it only records what the client owes us and
+   returns. Until the reply comes, the key events of the client are held
+   in its pending queue, like in sync mode. _Xi18nMessageHandler resumes
+   the client when the reply arrives. A wait overdue by XIM_WAIT_TIMEOUT
+   counts as a stall, and the client is resumed by its next message or
+   by _Xi18nExpireWaits(), whichever comes first. */
+Bool _Xi18nWaitReply (XIMS ims,
+                      CARD16 connect_id,
+                      CARD8 major_opcode,
+                      CARD8 minor_opcode)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    Xi18nClient **p;
 
-    free (reply);
-    free (reply_hdr);
-    FrameMgrFree (fm);
+    if (client == NULL)
+        return False;
+    /*endif*/
+
+    /* the request we are waiting a reply for may still be queued */
+    _Xi18nFlush (ims);
+
+    /* every deadline is XIM_WAIT_TIMEOUT after its wait began, so
+       appending keeps waiting_clients in deadline order */
+    _Xi18nEndWait (i18n_core, client);
+    for (p = &i18n_core->address.waiting_clients;  *p != NULL;  p = &(*p)->wait_next)
+        ;
+    /*endfor*/
+    *p = client;
+    client->wait_next = NULL;
+    client->waiting = True;
+    client->wait_major = major_opcode;
+    client->wait_minor = minor_opcode;
+    client->wait_deadline = _Xi18nTime () + XIM_WAIT_TIMEOUT;
+    i18n_core->address.stats.waits++;
+    return True;
+}
+
+/* The reply has come, or we gave up on it, or the client is gone */
+void _Xi18nEndWait (Xi18n i18n_core, Xi18nClient *client)
+{
+    Xi18nClient **p;
+
+    if (!client->waiting)
+        return;
+    /*endif*/
+    client->waiting = False;
+    for (p = &i18n_core->address.waiting_clients;  *p != NULL;  p = &(*p)->wait_next)
+    {
+        if (*p == client)
+        {
+            *p = client->wait_next;
+            break;
+        }
+        /*endif*/
+    }
+    /*endfor*/
+    client->wait_next = NULL;
+}
+
+/* While corked, the transports only queue outgoing messages.
+   _Xi18nMessageHandler corks itself, so all the replies and callbacks
+   one request produces go out with a single flush. */
+void _Xi18nCork (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+
+    i18n_core->address.cork++;
+}
+
+void _Xi18nUncork (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+
+    if (--i18n_core->address.cork == 0)
+        _Xi18nFlush (ims);
+    /*endif*/
+}
+
+void _Xi18nFlush (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+
+    if (i18n_core->address.stats.queue_depth == 0
+        &&
+        i18n_core->address.blocked_clients == 0)
+    {
+        return;
+    }
+    /*endif*/
+    if (i18n_core->methods.flush)
+        i18n_core->methods.flush (ims);
+    /*endif*/
+    if (i18n_core->trans_methods.flush)
+        i18n_core->trans_methods.flush (ims);
+    /*endif*/
+    i18n_core->address.stats.flushes++;
+    i18n_core->address.stats.queue_depth = 0;
 }
 
 void _Xi18nSendTriggerKey (XIMS ims, CARD16 connect_id)
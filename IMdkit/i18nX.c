@@ -40,7 +40,7 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 extern Xi18nClient *_Xi18nFindClient(Xi18n, CARD16);
 extern Xi18nClient *_Xi18nNewClient(Xi18n);
 extern void _Xi18nDeleteClient(Xi18n, CARD16);
-extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *, Bool *);
+extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *);
 
 static Bool WaitXConnectMessage(Display*, Window,
                                 XEvent*, XPointer);
@@ -49,10 +49,24 @@ static Bool WaitXIMProtocol(Display*, Window, XEvent*, XPointer);
 static XClient *NewXClient (Xi18n i18n_core, Window new_client)
 {
     Display *dpy = i18n_core->address.dpy;
-    Xi18nClient *client = _Xi18nNewClient (i18n_core);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Xi18nClient *client;
     XClient *x_client;
+    char atom_names[XCM_PROPERTY_ATOMS][32];
+    char *names[XCM_PROPERTY_ATOMS];
+    int i;
 
     x_client = (XClient *) malloc (sizeof (XClient));
+    if (x_client == NULL)
+        return NULL;
+    /*endif*/
+    client = _Xi18nNewClient (i18n_core);
+    if (client == NULL)
+    {
+        free (x_client);
+        return NULL;
+    }
+    /*endif*/
     x_client->client_win = new_client;
     x_client->accept_win = XCreateSimpleWindow (dpy,
                                                 DefaultRootWindow(dpy),
@@ -63,38 +77,58 @@ static XClient *NewXClient (Xi18n i18n_core, Window new_client)
                                                 1,
                                                 0,
                                                 0);
+
+    /* Intern all the property atoms in one round trip now, so that
+       sending a long message never has to wait for the X server. */
+    for (i = 0;  i < XCM_PROPERTY_ATOMS;  i++)
+    {
+        snprintf (atom_names[i], sizeof (atom_names[i]),
+                  "_server%d_%d", client->connect_id, i);
+        names[i] = atom_names[i];
+    }
+    /*endfor*/
+    XInternAtoms (dpy, names, XCM_PROPERTY_ATOMS, False, x_client->atoms);
+    x_client->atom_index = 0;
+
+    XSaveContext (dpy,
+                  x_client->accept_win,
+                  spec->client_context,
+                  (XPointer) client);
     client->trans_rec = x_client;
     return ((XClient *) x_client);
 }
 
+/* Returns the message in the event, or in the property it refers to.
+   The message is not copied: it points into ev, or into a buffer that
+   is returned in *prop_ret and has to be released with XFree() once the
+   message has been handled. */
 static unsigned char *ReadXIMMessage (XIMS ims,
                                       XClientMessageEvent *ev,
-                                      int *connect_id)
+                                      int *connect_id,
+                                      unsigned char **prop_ret)
 {
     Xi18n i18n_core = ims->protocol;
-    Xi18nClient *client = i18n_core->address.clients;
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Xi18nClient *client = NULL;
     XClient *x_client = NULL;
-    FrameMgr fm;
-    extern XimFrameRec packet_header_fr[];
     unsigned char *p = NULL;
-    unsigned char *p1;
 
-    while (client != NULL) {
-        x_client = (XClient *) client->trans_rec;
-        if (x_client->accept_win == ev->window) {
-            *connect_id = client->connect_id;
-            break;
-        }
-        client = client->next;
+    *prop_ret = NULL;
+    if (XFindContext (i18n_core->address.dpy,
+                      ev->window,
+                      spec->client_context,
+                      (XPointer *) &client) != 0)
+    {
+        return (unsigned char *) NULL;
     }
+    /*endif*/
+    x_client = (XClient *) client->trans_rec;
+    *connect_id = client->connect_id;
 
     if (ev->format == 8) {
         /* ClientMessage only */
         XimProtoHdr *hdr = (XimProtoHdr *) ev->data.b;
         unsigned char *rec = (unsigned char *) (hdr + 1);
-        register int total_size;
-        CARD8 major_opcode;
-        CARD8 minor_opcode;
         CARD16 length;
         extern int _Xi18nNeedSwap (Xi18n, CARD16);
 
@@ -105,27 +139,15 @@ static unsigned char *ReadXIMMessage (XIMS ims,
             client->byte_order = (CARD8) rec[0];
         }
 
-        fm = FrameMgrInit (packet_header_fr,
-                           (char *) hdr,
-                           _Xi18nNeedSwap (i18n_core, *connect_id));
-        total_size = FrameMgrGetTotalSize (fm);
-        /* get data */
-        FrameMgrGetToken (fm, major_opcode);
-        FrameMgrGetToken (fm, minor_opcode);
-        FrameMgrGetToken (fm, length);
-        FrameMgrFree (fm);
-
-        if ((p = (unsigned char *) malloc (total_size + length * 4)) == NULL)
+        length = hdr->length;
+        if (_Xi18nNeedSwap (i18n_core, *connect_id))
+            length = ((length << 8) & 0xFF00) | ((length >> 8) & 0xFF);
+        /*endif*/
+        if (sizeof (XimProtoHdr) + length * 4 > sizeof (ev->data.b))
             return (unsigned char *) NULL;
+        /*endif*/
 
-        p1 = p;
-        memmove (p1, &major_opcode, sizeof (CARD8));
-        p1 += sizeof (CARD8);
-        memmove (p1, &minor_opcode, sizeof (CARD8));
-        p1 += sizeof (CARD8);
-        memmove (p1, &length, sizeof (CARD16));
-        p1 += sizeof (CARD16);
-        memmove (p1, rec, length * 4);
+        p = (unsigned char *) hdr;
     }
     else if (ev->format == 32) {
         /* ClientMessage and WindowProperty */
@@ -155,19 +177,9 @@ static unsigned char *ReadXIMMessage (XIMS ims,
                 XFree (prop);
             return (unsigned char *) NULL;
         }
-        if (length != nitems)
-            length = nitems;
-	if (actual_format_ret == 16)
-	    length *= 2;
-	else if (actual_format_ret == 32)
-	    length *= 4;
-
-        /* if hit, it might be an error */
-        if ((p = (unsigned char *) malloc (length)) == NULL)
-            return (unsigned char *) NULL;
 
-        memmove (p, prop, length);
-        XFree (prop);
+        p = prop;
+        *prop_ret = prop;
     }
     return (unsigned char *) p;
 }
@@ -181,7 +193,7 @@ static void ReadXConnectMessage (XIMS ims, XClientMessageEvent *ev)
     Window new_client = ev->data.l[0];
     CARD32 major_version = ev->data.l[1];
     CARD32 minor_version = ev->data.l[2];
-    XClient *x_client = NewXClient (i18n_core, new_client);
+    XClient *x_client;
 
     if (ev->window != i18n_core->address.im_window)
         return; 			/* incorrect connection request */
@@ -193,6 +205,10 @@ static void ReadXConnectMessage (XIMS ims, XClientMessageEvent *ev)
         /* Only supporting only-CM & Property-with-CM method */
     }
     /*endif*/
+    x_client = NewXClient (i18n_core, new_client);
+    if (x_client == NULL)
+        return;
+    /*endif*/
     _XRegisterFilterByType (dpy,
                             x_client->accept_win,
                             ClientMessage,
@@ -229,6 +245,7 @@ static Bool Xi18nXBegin (XIMS ims)
     spec->connect_request = XInternAtom (i18n_core->address.dpy,
                                          _XIM_XCONNECT,
                                          False);
+    spec->client_context = XUniqueContext ();
 
     _XRegisterFilterByType (dpy,
                             i18n_core->address.im_window,
@@ -251,27 +268,12 @@ static Bool Xi18nXEnd(XIMS ims)
     return True;
 }
 
-static char *MakeNewAtom (CARD16 connect_id, char *atomName, size_t atomNameLen)
+static void SendXMessage (Xi18n i18n_core,
+                          XClient *x_client,
+                          unsigned char *reply,
+                          long length)
 {
-    static int sequence = 0;
-    
-    snprintf (atomName, atomNameLen - 1,
-             "_server%d_%d",
-             connect_id,
-             ((sequence > 20)  ?  (sequence = 0)  :  sequence++));
-    atomName[atomNameLen - 1] = '\0';
-    return atomName;
-}
-
-static Bool Xi18nXSend (XIMS ims,
-                        CARD16 connect_id,
-                        unsigned char *reply,
-                        long length)
-{
-    Xi18n i18n_core = ims->protocol;
-    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
     XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
-    XClient *x_client = (XClient *) client->trans_rec;
     XEvent event;
 
     event.type = ClientMessage;
@@ -280,37 +282,11 @@ static Bool Xi18nXSend (XIMS ims,
 
     if (length > XCM_DATA_LIMIT)
     {
-        Atom atom;
-        char atomName[32];
-        Atom actual_type_ret;
-        int actual_format_ret;
-        int return_code;
-        unsigned long nitems_ret;
-        unsigned long bytes_after_ret;
-        unsigned char *win_data;
+        Atom atom = x_client->atoms[x_client->atom_index];
+
+        x_client->atom_index = (x_client->atom_index + 1) % XCM_PROPERTY_ATOMS;
 
         event.xclient.format = 32;
-        atom = XInternAtom (i18n_core->address.dpy,
-                            MakeNewAtom (connect_id, atomName,sizeof(atomName)),
-                            False);
-        return_code = XGetWindowProperty (i18n_core->address.dpy,
-                                          x_client->client_win,
-                                          atom,
-                                          0L,
-                                          10000L,
-                                          False,
-                                          XA_STRING,
-                                          &actual_type_ret,
-                                          &actual_format_ret,
-                                          &nitems_ret,
-                                          &bytes_after_ret,
-                                          &win_data);
-        if (return_code != Success)
-            return False;
-        /*endif*/
-        if (win_data)
-            XFree ((char *) win_data);
-        /*endif*/
         XChangeProperty (i18n_core->address.dpy,
                          x_client->client_win,
                          atom,
@@ -342,85 +318,38 @@ static Bool Xi18nXSend (XIMS ims,
                 False,
                 NoEventMask,
                 &event);
-    XFlush (i18n_core->address.dpy);
-    return True;
+    i18n_core->address.stats.packets++;
 }
 
-static Bool CheckCMEvent (Display *display, XEvent *event, XPointer xi18n_core)
+static Bool Xi18nXSend (XIMS ims,
+                        CARD16 connect_id,
+                        unsigned char *reply,
+                        long length)
 {
-    Xi18n i18n_core = (Xi18n) ((void *) xi18n_core);
-    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
 
-    if ((event->type == ClientMessage)
-        &&
-        (event->xclient.message_type == spec->xim_request))
-    {
-        return  True;
-    }
-    /*endif*/
-    return  False;
+    SendXMessage (i18n_core, (XClient *) client->trans_rec, reply, length);
+    return True;
 }
 
-static Bool Xi18nXWait (XIMS ims,
-                        CARD16 connect_id,
-                        CARD8 major_opcode,
-                        CARD8 minor_opcode)
+static Bool Xi18nXFlush (XIMS ims)
 {
     Xi18n i18n_core = ims->protocol;
-    XEvent event;
-    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
-    XClient *x_client = (XClient *) client->trans_rec;
 
-    for (;;)
-    {
-        unsigned char *packet;
-        XimProtoHdr *hdr;
-        int connect_id_ret;
-
-        XIfEvent (i18n_core->address.dpy,
-                  &event,
-                  CheckCMEvent,
-                  (XPointer) i18n_core);
-        if (event.xclient.window == x_client->accept_win)
-        {
-            if ((packet = ReadXIMMessage (ims,
-                                          (XClientMessageEvent *) & event,
-                                          &connect_id_ret))
-                == (unsigned char*) NULL)
-            {
-                return False;
-            }
-            /*endif*/
-            hdr = (XimProtoHdr *)packet;
-
-            if ((hdr->major_opcode == major_opcode)
-                &&
-                (hdr->minor_opcode == minor_opcode))
-            {
-		Bool delete = True;
-		_Xi18nMessageHandler (ims, connect_id_ret, packet, &delete);
-		if (delete)
-		    free (packet);
-                return True;
-            }
-            else if (hdr->major_opcode == XIM_ERROR)
-            {
-                return False;
-            }
-            /*endif*/
-        }
-        /*endif*/
-    }
-    /*endfor*/
+    XFlush (i18n_core->address.dpy);
+    return True;
 }
 
 static Bool Xi18nXDisconnect (XIMS ims, CARD16 connect_id)
 {
     Xi18n i18n_core = ims->protocol;
     Display *dpy = i18n_core->address.dpy;
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
     Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
     XClient *x_client = (XClient *) client->trans_rec;
 
+    XDeleteContext (dpy, x_client->accept_win, spec->client_context);
     XDestroyWindow (dpy, x_client->accept_win);
     _XUnregisterFilter (dpy,
 		        x_client->accept_win,
@@ -445,8 +374,9 @@ Bool _Xi18nCheckXAddress (Xi18n i18n_core,
     i18n_core->methods.begin = Xi18nXBegin;
     i18n_core->methods.end = Xi18nXEnd;
     i18n_core->methods.send = Xi18nXSend;
-    i18n_core->methods.wait = Xi18nXWait;
+    i18n_core->methods.wait = _Xi18nWaitReply;
     i18n_core->methods.disconnect = Xi18nXDisconnect;
+    i18n_core->methods.flush = Xi18nXFlush;
     return True;
 }
 
@@ -474,12 +404,12 @@ static Bool WaitXIMProtocol (Display *dpy,
                              XEvent *ev,
                              XPointer client_data)
 {
-    extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *, Bool *);
+    extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *);
     XIMS ims = (XIMS) client_data;
     Xi18n i18n_core = ims->protocol;
     XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
-    Bool delete = True;
     unsigned char *packet;
+    unsigned char *prop;
     int connect_id;
 
     if (((XClientMessageEvent *) ev)->message_type
@@ -487,15 +417,16 @@ static Bool WaitXIMProtocol (Display *dpy,
     {
         if ((packet = ReadXIMMessage (ims,
                                       (XClientMessageEvent *) ev,
-                                      &connect_id))
+                                      &connect_id,
+                                      &prop))
             == (unsigned char *)  NULL)
         {
             return False;
         }
         /*endif*/
-        _Xi18nMessageHandler (ims, connect_id, packet, &delete);
-        if (delete == True)
-            free (packet);
+        _Xi18nMessageHandler (ims, connect_id, packet);
+        if (prop != NULL)
+            XFree (prop);
         /*endif*/
         return True;
     }
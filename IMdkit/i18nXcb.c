@@ -0,0 +1,559 @@
+/******************************************************************
+
+         Copyright 1994, 1995 by Sun Microsystems, Inc.
+         Copyright 1993, 1994 by Hewlett-Packard Company
+
+Permission to use, copy, modify, distribute, and sell this software
+and its documentation for any purpose is hereby granted without fee,
+provided that the above copyright notice appear in all copies and
+that both that copyright notice and this permission notice appear
+in supporting documentation, and that the name of Sun Microsystems, Inc.
+and Hewlett-Packard not be used in advertising or publicity pertaining to
+distribution of the software without specific, written prior permission.
+Sun Microsystems, Inc. and Hewlett-Packard make no representations about
+the suitability of this software for any purpose.  It is provided "as is"
+without express or implied warranty.
+
+SUN MICROSYSTEMS INC. AND HEWLETT-PACKARD COMPANY DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT SHALL
+SUN MICROSYSTEMS, INC. AND HEWLETT-PACKARD COMPANY BE LIABLE FOR ANY
+SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER
+RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF
+CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+  Author: Hidetoshi Tajima(tajima@Eng.Sun.COM) Sun Microsystems, Inc.
+
+    This version tidied and debugged by Steve Underwood May 1999
+
+******************************************************************/
+
+/*
+ * X/ transport on xcb, selected with --enable-xcb.
+ *
+ * The protocol is the same as in i18nX.c, only the requests go out
+ * through the xcb connection underneath the Display, so that none of
+ * them has to wait for its reply right away:
+ *  - the atoms are interned with all requests sent before the first
+ *    reply is read, and the property atoms of a client only when its
+ *    first long message is sent;
+ *  - when a client message refers to a property, the properties of
+ *    the client's other messages already in the event queue are
+ *    requested too, so that a burst of messages costs one round trip
+ *    instead of one each;
+ *  - sends never need a reply and are written out on flush.
+ * Events are still read by Xlib and come here through XFilterEvent().
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <X11/Xlib.h>
+#include <X11/Xlib-xcb.h>
+#include <xcb/xcb.h>
+#include "FrameMgr.h"
+#include "IMdkit.h"
+#include "Xi18n.h"
+#include "Xi18nX.h"
+#include "XimFunc.h"
+
+extern Xi18nClient *_Xi18nFindClient(Xi18n, CARD16);
+extern Xi18nClient *_Xi18nNewClient(Xi18n);
+extern void _Xi18nDeleteClient(Xi18n, CARD16);
+extern void _Xi18nMessageHandler (XIMS, CARD16, unsigned char *);
+extern int _Xi18nNeedSwap (Xi18n, CARD16);
+
+static Bool WaitXcbConnectMessage (Display *, Window, XEvent *, XPointer);
+static Bool WaitXcbProtocol (Display *, Window, XEvent *, XPointer);
+
+static xcb_atom_t InternAtomReply (xcb_connection_t *conn,
+                                   xcb_intern_atom_cookie_t cookie)
+{
+    xcb_intern_atom_reply_t *reply;
+    xcb_atom_t atom = XCB_ATOM_NONE;
+
+    reply = xcb_intern_atom_reply (conn, cookie, NULL);
+    if (reply != NULL)
+    {
+        atom = reply->atom;
+        free (reply);
+    }
+    /*endif*/
+    return atom;
+}
+
+static XcbClient *NewXcbClient (Xi18n i18n_core, Window new_client)
+{
+    Display *dpy = i18n_core->address.dpy;
+    xcb_connection_t *conn = XGetXCBConnection (dpy);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Xi18nClient *client;
+    XcbClient *x_client;
+    uint32_t values[2];
+    char name[32];
+    int i;
+
+    x_client = (XcbClient *) malloc (sizeof (XcbClient));
+    if (x_client == NULL)
+        return NULL;
+    /*endif*/
+    client = _Xi18nNewClient (i18n_core);
+    if (client == NULL)
+    {
+        free (x_client);
+        return NULL;
+    }
+    /*endif*/
+
+    x_client->client_win = new_client;
+    x_client->accept_win = xcb_generate_id (conn);
+    values[0] = 0;		/* background pixel */
+    values[1] = 0;		/* border pixel */
+    xcb_create_window (conn,
+                       XCB_COPY_FROM_PARENT,
+                       x_client->accept_win,
+                       DefaultRootWindow (dpy),
+                       0,
+                       0,
+                       1,
+                       1,
+                       1,
+                       XCB_WINDOW_CLASS_INPUT_OUTPUT,
+                       XCB_COPY_FROM_PARENT,
+                       XCB_CW_BACK_PIXEL | XCB_CW_BORDER_PIXEL,
+                       values);
+
+    /* the replies are read when the first long message is sent, most
+       clients never get one before they have sent a few themselves */
+    for (i = 0;  i < XCM_PROPERTY_ATOMS;  i++)
+    {
+        snprintf (name, sizeof (name),
+                  "_server%d_%d", client->connect_id, i);
+        x_client->atom_cookies[i] = xcb_intern_atom (conn,
+                                                     False,
+                                                     strlen (name),
+                                                     name);
+    }
+    /*endfor*/
+    x_client->atoms_pending = True;
+    x_client->atom_index = 0;
+
+    XSaveContext (dpy,
+                  x_client->accept_win,
+                  spec->client_context,
+                  (XPointer) client);
+    client->trans_rec = x_client;
+    return x_client;
+}
+
+static xcb_atom_t NextXcbAtom (xcb_connection_t *conn, XcbClient *x_client)
+{
+    xcb_atom_t atom;
+    int i;
+
+    if (x_client->atoms_pending)
+    {
+        for (i = 0;  i < XCM_PROPERTY_ATOMS;  i++)
+        {
+            x_client->atoms[i] = InternAtomReply (conn,
+                                                  x_client->atom_cookies[i]);
+        }
+        /*endfor*/
+        x_client->atoms_pending = False;
+    }
+    /*endif*/
+    atom = x_client->atoms[x_client->atom_index];
+    x_client->atom_index = (x_client->atom_index + 1) % XCM_PROPERTY_ATOMS;
+    return atom;
+}
+
+/* Returns the message carried in the event itself, NULL if it is not
+   a valid one. */
+static unsigned char *ReadXcbShortMessage (Xi18n i18n_core,
+                                           Xi18nClient *client,
+                                           XClientMessageEvent *ev)
+{
+    XimProtoHdr *hdr = (XimProtoHdr *) ev->data.b;
+    unsigned char *rec = (unsigned char *) (hdr + 1);
+    CARD16 length;
+
+    if (client->byte_order == '?')
+    {
+        if (hdr->major_opcode != XIM_CONNECT)
+            return (unsigned char *) NULL; 	/* can do nothing */
+        /*endif*/
+        client->byte_order = (CARD8) rec[0];
+    }
+    /*endif*/
+
+    length = hdr->length;
+    if (_Xi18nNeedSwap (i18n_core, client->connect_id))
+        length = ((length << 8) & 0xFF00) | ((length >> 8) & 0xFF);
+    /*endif*/
+    if (sizeof (XimProtoHdr) + length * 4 > sizeof (ev->data.b))
+        return (unsigned char *) NULL;
+    /*endif*/
+    return (unsigned char *) hdr;
+}
+
+static Bool IsXcbProtocolMessage (Display *dpy, XEvent *ev, XPointer arg)
+{
+    XClientMessageEvent *first = (XClientMessageEvent *) arg;
+
+    return ev->type == ClientMessage
+           &&
+           ev->xclient.window == first->window
+           &&
+           ev->xclient.message_type == first->message_type;
+}
+
+/* Handles the message in first and the ones of the same client that
+   are already queued behind it, in order. */
+static Bool ReadXcbMessages (XIMS ims, XClientMessageEvent *first)
+{
+    Xi18n i18n_core = ims->protocol;
+    Display *dpy = i18n_core->address.dpy;
+    xcb_connection_t *conn = XGetXCBConnection (dpy);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    XClientMessageEvent events[XCB_READ_AHEAD];
+    xcb_get_property_cookie_t cookies[XCB_READ_AHEAD];
+    Xi18nClient *client = NULL;
+    XcbClient *x_client;
+    CARD16 connect_id;
+    XEvent event;
+    int n;
+    int i;
+
+    if (XFindContext (dpy,
+                      first->window,
+                      spec->client_context,
+                      (XPointer *) &client) != 0)
+    {
+        return False;
+    }
+    /*endif*/
+    x_client = (XcbClient *) client->trans_rec;
+    connect_id = client->connect_id;
+
+    events[0] = *first;
+    n = 1;
+    while (n < XCB_READ_AHEAD
+           &&
+           XCheckIfEvent (dpy, &event, IsXcbProtocolMessage, (XPointer) first))
+    {
+        events[n++] = event.xclient;
+    }
+    /*endwhile*/
+
+    for (i = 0;  i < n;  i++)
+    {
+        if (events[i].format == 32)
+        {
+            cookies[i] = xcb_get_property (conn,
+                                           True,
+                                           x_client->accept_win,
+                                           (xcb_atom_t) events[i].data.l[1],
+                                           XCB_GET_PROPERTY_TYPE_ANY,
+                                           0,
+                                           (uint32_t) events[i].data.l[0]);
+        }
+        /*endif*/
+    }
+    /*endfor*/
+
+    for (i = 0;  i < n;  i++)
+    {
+        unsigned char *packet = NULL;
+        xcb_get_property_reply_t *reply = NULL;
+
+        /* XIM_DISCONNECT may have removed the client on the way, the
+           replies are read anyway */
+        client = _Xi18nFindClient (i18n_core, connect_id);
+
+        if (events[i].format == 32)
+        {
+            reply = xcb_get_property_reply (conn, cookies[i], NULL);
+            if (reply != NULL
+                &&
+                reply->format != 0
+                &&
+                xcb_get_property_value_length (reply) > 0)
+            {
+                packet = (unsigned char *) xcb_get_property_value (reply);
+            }
+            /*endif*/
+        }
+        else if (events[i].format == 8  &&  client != NULL)
+        {
+            packet = ReadXcbShortMessage (i18n_core, client, &events[i]);
+        }
+        /*endif*/
+
+        if (packet != NULL  &&  client != NULL)
+            _Xi18nMessageHandler (ims, connect_id, packet);
+        /*endif*/
+        free (reply);
+    }
+    /*endfor*/
+    return True;
+}
+
+static void ReadXcbConnectMessage (XIMS ims, XClientMessageEvent *ev)
+{
+    Xi18n i18n_core = ims->protocol;
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Display *dpy = i18n_core->address.dpy;
+    xcb_connection_t *conn = XGetXCBConnection (dpy);
+    xcb_client_message_event_t event;
+    Window new_client = ev->data.l[0];
+    CARD32 major_version = ev->data.l[1];
+    CARD32 minor_version = ev->data.l[2];
+    XcbClient *x_client;
+
+    if (ev->window != i18n_core->address.im_window)
+        return; 			/* incorrect connection request */
+    /*endif*/
+    if (major_version != 0  ||  minor_version != 0)
+    {
+        major_version =
+        minor_version = 0;
+        /* Only supporting only-CM & Property-with-CM method */
+    }
+    /*endif*/
+    x_client = NewXcbClient (i18n_core, new_client);
+    if (x_client == NULL)
+        return;
+    /*endif*/
+    _XRegisterFilterByType (dpy,
+                            x_client->accept_win,
+                            ClientMessage,
+                            ClientMessage,
+                            WaitXcbProtocol,
+                            (XPointer) ims);
+
+    memset (&event, 0, sizeof (event));
+    event.response_type = XCB_CLIENT_MESSAGE;
+    event.format = 32;
+    event.window = new_client;
+    event.type = spec->connect_request;
+    event.data.data32[0] = x_client->accept_win;
+    event.data.data32[1] = major_version;
+    event.data.data32[2] = minor_version;
+    event.data.data32[3] = XCM_DATA_LIMIT;
+
+    xcb_send_event (conn,
+                    False,
+                    new_client,
+                    XCB_EVENT_MASK_NO_EVENT,
+                    (const char *) &event);
+    XFlush (dpy);
+}
+
+static Bool XcbBegin (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    Display *dpy = i18n_core->address.dpy;
+    xcb_connection_t *conn = XGetXCBConnection (dpy);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    xcb_intern_atom_cookie_t xim_request;
+    xcb_intern_atom_cookie_t connect_request;
+
+    xim_request = xcb_intern_atom (conn,
+                                   False,
+                                   strlen (_XIM_PROTOCOL),
+                                   _XIM_PROTOCOL);
+    connect_request = xcb_intern_atom (conn,
+                                       False,
+                                       strlen (_XIM_XCONNECT),
+                                       _XIM_XCONNECT);
+    spec->xim_request = InternAtomReply (conn, xim_request);
+    spec->connect_request = InternAtomReply (conn, connect_request);
+    if (spec->xim_request == None  ||  spec->connect_request == None)
+        return False;
+    /*endif*/
+    spec->client_context = XUniqueContext ();
+
+    _XRegisterFilterByType (dpy,
+                            i18n_core->address.im_window,
+                            ClientMessage,
+                            ClientMessage,
+                            WaitXcbConnectMessage,
+                            (XPointer) ims);
+    return True;
+}
+
+static Bool XcbEnd (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+    Display *dpy = i18n_core->address.dpy;
+
+    _XUnregisterFilter (dpy,
+                        i18n_core->address.im_window,
+                        WaitXcbConnectMessage,
+                        (XPointer) ims);
+    return True;
+}
+
+static void SendXcbMessage (Xi18n i18n_core,
+                            XcbClient *x_client,
+                            unsigned char *reply,
+                            long length)
+{
+    xcb_connection_t *conn = XGetXCBConnection (i18n_core->address.dpy);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    xcb_client_message_event_t event;
+
+    memset (&event, 0, sizeof (event));
+    event.response_type = XCB_CLIENT_MESSAGE;
+    event.window = x_client->client_win;
+    event.type = spec->xim_request;
+
+    if (length > XCM_DATA_LIMIT)
+    {
+        xcb_atom_t atom = NextXcbAtom (conn, x_client);
+
+        event.format = 32;
+        xcb_change_property (conn,
+                             XCB_PROP_MODE_APPEND,
+                             x_client->client_win,
+                             atom,
+                             XCB_ATOM_STRING,
+                             8,
+                             length,
+                             reply);
+        event.data.data32[0] = length;
+        event.data.data32[1] = atom;
+    }
+    else
+    {
+        /* the rest of the data is already cleared */
+        event.format = 8;
+        memmove (event.data.data8, reply, length);
+    }
+    /*endif*/
+    xcb_send_event (conn,
+                    False,
+                    x_client->client_win,
+                    XCB_EVENT_MASK_NO_EVENT,
+                    (const char *) &event);
+    i18n_core->address.stats.packets++;
+}
+
+static Bool XcbSend (XIMS ims,
+                     CARD16 connect_id,
+                     unsigned char *reply,
+                     long length)
+{
+    Xi18n i18n_core = ims->protocol;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+
+    if (client == NULL)
+        return False;
+    /*endif*/
+    SendXcbMessage (i18n_core, (XcbClient *) client->trans_rec, reply, length);
+    return True;
+}
+
+static Bool XcbFlush (XIMS ims)
+{
+    Xi18n i18n_core = ims->protocol;
+
+    /* writes out what Xlib still holds too, then the xcb buffer */
+    XFlush (i18n_core->address.dpy);
+    return True;
+}
+
+static Bool XcbDisconnect (XIMS ims, CARD16 connect_id)
+{
+    Xi18n i18n_core = ims->protocol;
+    Display *dpy = i18n_core->address.dpy;
+    xcb_connection_t *conn = XGetXCBConnection (dpy);
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+    Xi18nClient *client = _Xi18nFindClient (i18n_core, connect_id);
+    XcbClient *x_client;
+    int i;
+
+    if (client == NULL)
+        return False;
+    /*endif*/
+    x_client = (XcbClient *) client->trans_rec;
+
+    XDeleteContext (dpy, x_client->accept_win, spec->client_context);
+    xcb_destroy_window (conn, x_client->accept_win);
+    _XUnregisterFilter (dpy,
+                        x_client->accept_win,
+                        WaitXcbProtocol,
+                        (XPointer) ims);
+    if (x_client->atoms_pending)
+    {
+        for (i = 0;  i < XCM_PROPERTY_ATOMS;  i++)
+            xcb_discard_reply (conn, x_client->atom_cookies[i].sequence);
+        /*endfor*/
+    }
+    /*endif*/
+    free (x_client);
+    _Xi18nDeleteClient (i18n_core, connect_id);
+    return True;
+}
+
+Bool _Xi18nCheckXcbAddress (Xi18n i18n_core,
+                            TransportSW *transSW,
+                            char *address)
+{
+    XSpecRec *spec;
+
+    if (!(spec = (XSpecRec *) malloc (sizeof (XSpecRec))))
+        return False;
+    /*endif*/
+
+    i18n_core->address.connect_addr = (XSpecRec *) spec;
+    i18n_core->methods.begin = XcbBegin;
+    i18n_core->methods.end = XcbEnd;
+    i18n_core->methods.send = XcbSend;
+    i18n_core->methods.wait = _Xi18nWaitReply;
+    i18n_core->methods.disconnect = XcbDisconnect;
+    i18n_core->methods.flush = XcbFlush;
+    return True;
+}
+
+static Bool WaitXcbConnectMessage (Display *dpy,
+                                   Window win,
+                                   XEvent *ev,
+                                   XPointer client_data)
+{
+    XIMS ims = (XIMS) client_data;
+    Xi18n i18n_core = ims->protocol;
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+
+    if (((XClientMessageEvent *) ev)->message_type
+        == spec->connect_request)
+    {
+        ReadXcbConnectMessage (ims, (XClientMessageEvent *) ev);
+        return True;
+    }
+    /*endif*/
+    return False;
+}
+
+static Bool WaitXcbProtocol (Display *dpy,
+                             Window win,
+                             XEvent *ev,
+                             XPointer client_data)
+{
+    XIMS ims = (XIMS) client_data;
+    Xi18n i18n_core = ims->protocol;
+    XSpecRec *spec = (XSpecRec *) i18n_core->address.connect_addr;
+
+    if (((XClientMessageEvent *) ev)->message_type
+        == spec->xim_request)
+    {
+        return ReadXcbMessages (ims, (XClientMessageEvent *) ev);
+    }
+    /*endif*/
+    return False;
+}
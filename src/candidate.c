@@ -260,6 +260,7 @@ nabi_candidate_set_window_position(NabiCandidate *candidate)
     int absy = 0;
     int root_w, root_h, cand_w, cand_h;
     GtkRequisition requisition;
+    GdkScreen *screen;
 
     if (candidate == NULL ||
 	candidate->parent == 0 ||
@@ -267,15 +268,16 @@ nabi_candidate_set_window_position(NabiCandidate *candidate)
 	return;
 
     /* move candidate window to focus window below */
-    XGetGeometry(nabi_server->display,
+    XGetGeometry(candidate->server->display,
 		 candidate->parent,
 		 &root, &x, &y, &width, &height, &border, &depth);
-    XTranslateCoordinates(nabi_server->display,
+    XTranslateCoordinates(candidate->server->display,
 			  candidate->parent, root,
 			  0, 0, &absx, &absy, &child);
 
-    root_w = gdk_screen_width();
-    root_h = gdk_screen_height();
+    screen = gtk_window_get_screen(GTK_WINDOW(candidate->window));
+    root_w = gdk_screen_get_width(screen);
+    root_h = gdk_screen_get_height(screen);
 
     gtk_widget_size_request(GTK_WIDGET(candidate->window), &requisition);
     cand_w = requisition.width;
@@ -305,7 +307,7 @@ nabi_candidate_update_list(NabiCandidate *candidate)
 	const char* comment = hanja_get_comment(hanja);
 	char* candidate_str;
 
-	if (nabi_server->use_simplified_chinese) {
+	if (candidate->use_simplified_chinese) {
 	    candidate_str = nabi_traditional_to_simplified(value);
 	} else {
 	    candidate_str = g_strdup(value);
@@ -348,6 +350,10 @@ nabi_candidate_create_window(NabiCandidate *candidate)
     GtkCellRenderer *renderer;
 
     candidate->window = gtk_window_new(GTK_WINDOW_POPUP);
+    /* on the display of the client */
+    gtk_window_set_screen(GTK_WINDOW(candidate->window),
+		    gdk_display_get_screen(candidate->server->gdk_display,
+					   candidate->server->screen));
 
     nabi_candidate_update_list(candidate);
 
@@ -400,8 +406,8 @@ nabi_candidate_create_window(NabiCandidate *candidate)
 
     /* character column */
     renderer = gtk_cell_renderer_text_new();
-    if (nabi_server->candidate_font != NULL)
-	g_object_set(renderer, "font-desc", nabi_server->candidate_font, NULL);
+    if (candidate->font != NULL)
+	g_object_set(renderer, "font-desc", candidate->font, NULL);
     column = gtk_tree_view_column_new_with_attributes("Character",
 						      renderer,
 						      "text", COLUMN_CHARACTER,
@@ -458,18 +464,22 @@ nabi_candidate_create_window(NabiCandidate *candidate)
 }
 
 NabiCandidate*
-nabi_candidate_new(const char *label_str,
+nabi_candidate_new(NabiServer *server,
+		   const char *label_str,
 		   int n_per_page,
 		   HanjaList *list,
 		   const Hanja **valid_list,
 		   int valid_list_length,
 		   Window parent,
+		   const PangoFontDescription *font,
+		   gboolean use_simplified_chinese,
 		   NabiCandidateCommitFunc commit,
 		   gpointer commit_data)
 {
     NabiCandidate *candidate;
 
     candidate = (NabiCandidate*)g_malloc(sizeof(NabiCandidate));
+    candidate->server = server;
     candidate->first = 0;
     candidate->current = 0;
     candidate->n_per_page = n_per_page;
@@ -482,6 +492,10 @@ nabi_candidate_new(const char *label_str,
     candidate->commit = commit;
     candidate->commit_data = commit_data;
     candidate->hanja_list = list;
+    candidate->font = NULL;
+    if (font != NULL)
+	candidate->font = pango_font_description_copy(font);
+    candidate->use_simplified_chinese = use_simplified_chinese;
 
     candidate->data = valid_list;
     candidate->n = valid_list_length;
@@ -595,6 +609,8 @@ nabi_candidate_delete(NabiCandidate *candidate)
     gtk_grab_remove(candidate->window);
     gtk_widget_destroy(candidate->window);
     g_free(candidate->data);
+    if (candidate->font != NULL)
+	pango_font_description_free(candidate->font);
     g_free(candidate);
 }
 
@@ -25,9 +25,11 @@
 #include <hangul.h>
 
 typedef struct _NabiCandidate     NabiCandidate;
+struct _NabiServer;
 typedef void (*NabiCandidateCommitFunc)(NabiCandidate*, const Hanja*, gpointer);
 
 struct _NabiCandidate {
+    struct _NabiServer *server;
     GtkWidget *window;
     Window parent;
     GtkLabel *label;
@@ -41,14 +43,19 @@ struct _NabiCandidate {
     int n_per_page;
     int current;
     HanjaList *hanja_list;
+    PangoFontDescription *font;
+    gboolean use_simplified_chinese;
 };
 
-NabiCandidate*     nabi_candidate_new(const char *label_str,
+NabiCandidate*     nabi_candidate_new(struct _NabiServer *server,
+				      const char *label_str,
 		   	              int n_per_page,
 			              HanjaList* list,
 			              const Hanja** valid_list,
 			              int valid_list_length,
 			              Window parent,
+				      const PangoFontDescription* font,
+				      gboolean use_simplified_chinese,
 				      NabiCandidateCommitFunc commit,
 				      gpointer commit_data);
 void               nabi_candidate_prev(NabiCandidate *candidate);
@@ -0,0 +1,510 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "channel.h"
+#include "debug.h"
+
+/* a line longer than this is not from nabi */
+#define NABI_CHANNEL_MAX_LINE	1024
+/* the dirty flags of a peer are bits of a guint32 */
+#define NABI_CHANNEL_MAX_NAMES	32
+
+#ifdef MSG_NOSIGNAL
+#define NABI_CHANNEL_SEND_FLAGS	MSG_NOSIGNAL
+#else
+#define NABI_CHANNEL_SEND_FLAGS	0
+#endif
+
+typedef struct {
+    NabiChannel* channel;
+    int          fd;
+    guint        in_id;
+    guint        out_id;
+    GString*     in;
+    GString*     out;
+    guint32      dirty;		/* values not sent yet */
+} NabiChannelPeer;
+
+struct _NabiChannel {
+    char*           path;	/* the socket we listen on */
+    int             fd;		/* -1 on the connecting side */
+    guint           accept_id;
+    GMainContext*   context;
+    GPtrArray*      names;
+    GPtrArray*      values;
+    GSList*         peers;
+    NabiChannelFunc func;
+    gpointer        data;
+};
+
+static guint
+nabi_channel_add_watch(NabiChannel* channel, int fd, GIOCondition condition,
+		       GIOFunc func, gpointer data)
+{
+    GIOChannel* io;
+    GSource* source;
+    guint id;
+
+    io = g_io_channel_unix_new(fd);
+    source = g_io_create_watch(io, condition);
+    g_source_set_callback(source, (GSourceFunc)func, data, NULL);
+    id = g_source_attach(source, channel->context);
+    g_source_unref(source);
+    g_io_channel_unref(io);
+
+    return id;
+}
+
+static void
+nabi_channel_remove_watch(NabiChannel* channel, guint id)
+{
+    GSource* source;
+
+    if (id == 0)
+	return;
+
+    source = g_main_context_find_source_by_id(channel->context, id);
+    if (source != NULL)
+	g_source_destroy(source);
+}
+
+static void
+nabi_channel_set_nonblock(int fd)
+{
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+static gboolean nabi_channel_peer_read(GIOChannel* io,
+				       GIOCondition condition, gpointer data);
+static gboolean nabi_channel_peer_write(GIOChannel* io,
+				        GIOCondition condition, gpointer data);
+
+static NabiChannelPeer*
+nabi_channel_peer_new(NabiChannel* channel, int fd)
+{
+    NabiChannelPeer* peer;
+
+    nabi_channel_set_nonblock(fd);
+
+    peer = g_new(NabiChannelPeer, 1);
+    peer->channel = channel;
+    peer->fd = fd;
+    peer->in = g_string_new(NULL);
+    peer->out = g_string_new(NULL);
+    peer->dirty = 0;
+    peer->out_id = 0;
+    peer->in_id = nabi_channel_add_watch(channel, fd,
+					 G_IO_IN | G_IO_HUP | G_IO_ERR,
+					 nabi_channel_peer_read, peer);
+
+    channel->peers = g_slist_prepend(channel->peers, peer);
+
+    return peer;
+}
+
+static void
+nabi_channel_peer_free(NabiChannelPeer* peer)
+{
+    NabiChannel* channel = peer->channel;
+
+    channel->peers = g_slist_remove(channel->peers, peer);
+
+    nabi_channel_remove_watch(channel, peer->in_id);
+    nabi_channel_remove_watch(channel, peer->out_id);
+    close(peer->fd);
+    g_string_free(peer->in, TRUE);
+    g_string_free(peer->out, TRUE);
+    g_free(peer);
+}
+
+static void
+nabi_channel_peer_close(NabiChannelPeer* peer)
+{
+    NabiChannel* channel = peer->channel;
+
+    nabi_log(3, "channel: close peer %d\n", peer->fd);
+    nabi_channel_peer_free(peer);
+
+    if (channel->func != NULL)
+	channel->func(channel, NULL, NULL, channel->data);
+}
+
+/* the values are written only when the socket is ready, so a peer
+ * which lags behind gets the latest values in one go */
+static void
+nabi_channel_peer_mark(NabiChannelPeer* peer, guint32 dirty)
+{
+    peer->dirty |= dirty;
+    if (peer->out_id == 0)
+	peer->out_id = nabi_channel_add_watch(peer->channel, peer->fd,
+					      G_IO_OUT,
+					      nabi_channel_peer_write, peer);
+}
+
+static void
+nabi_channel_peer_fill(NabiChannelPeer* peer)
+{
+    NabiChannel* channel = peer->channel;
+    guint i;
+
+    for (i = 0; i < channel->names->len; i++) {
+	if (peer->dirty & (1U << i)) {
+	    g_string_append_printf(peer->out, "%s %s\n",
+			(const char*)g_ptr_array_index(channel->names, i),
+			(const char*)g_ptr_array_index(channel->values, i));
+	}
+    }
+    peer->dirty = 0;
+}
+
+static gboolean
+nabi_channel_peer_write(GIOChannel* io, GIOCondition condition, gpointer data)
+{
+    NabiChannelPeer* peer = (NabiChannelPeer*)data;
+    ssize_t n;
+
+    if (peer->out->len == 0)
+	nabi_channel_peer_fill(peer);
+
+    while (peer->out->len > 0) {
+	n = send(peer->fd, peer->out->str, peer->out->len,
+		 NABI_CHANNEL_SEND_FLAGS);
+	if (n < 0) {
+	    if (errno == EINTR)
+		continue;
+	    if (errno == EAGAIN || errno == EWOULDBLOCK)
+		return TRUE;
+	    peer->out_id = 0;
+	    nabi_channel_peer_close(peer);
+	    return FALSE;
+	}
+	g_string_erase(peer->out, 0, n);
+    }
+
+    peer->out_id = 0;
+    return FALSE;
+}
+
+/* returns the index of the value, or -1 if there is no room for it */
+static gint
+nabi_channel_store(NabiChannel* channel, const char* name, const char* value,
+		   gboolean* changed)
+{
+    char* old;
+    guint i;
+
+    for (i = 0; i < channel->names->len; i++) {
+	if (strcmp(g_ptr_array_index(channel->names, i), name) == 0)
+	    break;
+    }
+
+    if (i == channel->names->len) {
+	if (i >= NABI_CHANNEL_MAX_NAMES)
+	    return -1;
+	g_ptr_array_add(channel->names, g_strdup(name));
+	g_ptr_array_add(channel->values, g_strdup(value));
+	*changed = TRUE;
+	return i;
+    }
+
+    old = g_ptr_array_index(channel->values, i);
+    *changed = strcmp(old, value) != 0;
+    if (*changed) {
+	g_free(old);
+	g_ptr_array_index(channel->values, i) = g_strdup(value);
+    }
+
+    return i;
+}
+
+static void
+nabi_channel_peer_dispatch(NabiChannelPeer* peer, char* line)
+{
+    NabiChannel* channel = peer->channel;
+    char* value;
+
+    value = strchr(line, ' ');
+    if (value == NULL)
+	return;
+    *value++ = '\0';
+
+    nabi_log(4, "channel: %s = %s\n", line, value);
+
+    /* the listening side owns the values and sets them by itself,
+     * the other side just remembers what it has been told */
+    if (channel->fd < 0) {
+	gboolean changed;
+	nabi_channel_store(channel, line, value, &changed);
+    }
+
+    if (channel->func != NULL)
+	channel->func(channel, line, value, channel->data);
+}
+
+static gboolean
+nabi_channel_peer_read(GIOChannel* io, GIOCondition condition, gpointer data)
+{
+    NabiChannelPeer* peer = (NabiChannelPeer*)data;
+    char buf[256];
+    char* line;
+    char* end;
+    ssize_t n;
+
+    while (TRUE) {
+	n = read(peer->fd, buf, sizeof(buf));
+	if (n > 0) {
+	    g_string_append_len(peer->in, buf, n);
+	    continue;
+	}
+
+	if (n < 0 && errno == EINTR)
+	    continue;
+	if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+	    break;
+
+	/* eof or error */
+	peer->in_id = 0;
+	nabi_channel_peer_close(peer);
+	return FALSE;
+    }
+
+    line = peer->in->str;
+    while ((end = strchr(line, '\n')) != NULL) {
+	*end = '\0';
+	nabi_channel_peer_dispatch(peer, line);
+	line = end + 1;
+    }
+    g_string_erase(peer->in, 0, line - peer->in->str);
+
+    if (peer->in->len > NABI_CHANNEL_MAX_LINE) {
+	nabi_log(1, "channel: too long line, close peer %d\n", peer->fd);
+	peer->in_id = 0;
+	nabi_channel_peer_close(peer);
+	return FALSE;
+    }
+
+    return TRUE;
+}
+
+static gboolean
+nabi_channel_accept(GIOChannel* io, GIOCondition condition, gpointer data)
+{
+    NabiChannel* channel = (NabiChannel*)data;
+    NabiChannelPeer* peer;
+    int fd;
+
+    fd = accept(channel->fd, NULL, NULL);
+    if (fd < 0)
+	return TRUE;
+
+    nabi_log(3, "channel: new peer %d\n", fd);
+
+    /* a new peer gets all the values we have */
+    peer = nabi_channel_peer_new(channel, fd);
+    if (channel->names->len > 0)
+	nabi_channel_peer_mark(peer, (guint32)~0);
+
+    return TRUE;
+}
+
+static NabiChannel*
+nabi_channel_new(GMainContext* context, NabiChannelFunc func, gpointer data)
+{
+    NabiChannel* channel;
+
+    channel = g_new(NabiChannel, 1);
+    channel->path = NULL;
+    channel->fd = -1;
+    channel->accept_id = 0;
+    channel->context = context;
+    channel->names = g_ptr_array_new();
+    channel->values = g_ptr_array_new();
+    channel->peers = NULL;
+    channel->func = func;
+    channel->data = data;
+
+    return channel;
+}
+
+static int
+nabi_channel_socket(const char* path, struct sockaddr_un* addr)
+{
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+	nabi_log(1, "channel: too long socket path: %s\n", path);
+	return -1;
+    }
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+
+    return socket(AF_UNIX, SOCK_STREAM, 0);
+}
+
+/* The sockets are in a directory of the user, like the ones of ssh-agent:
+ * /tmp/nabi-USER/DISPLAY-XIMNAME */
+char*
+nabi_channel_get_path(const char* display_name, const char* xim_name)
+{
+    char* name;
+    char* path;
+
+    name = g_strdup_printf("%s-%s", display_name, xim_name);
+    g_strdelimit(name, G_DIR_SEPARATOR_S, '_');
+    path = g_strdup_printf("%s" G_DIR_SEPARATOR_S "nabi-%s"
+			   G_DIR_SEPARATOR_S "%s",
+			   g_get_tmp_dir(), g_get_user_name(), name);
+    g_free(name);
+
+    return path;
+}
+
+NabiChannel*
+nabi_channel_listen(const char* path, GMainContext* context,
+		    NabiChannelFunc func, gpointer data)
+{
+    NabiChannel* channel;
+    struct sockaddr_un addr;
+    struct stat st;
+    char* dir;
+    int fd;
+
+    /* nobody but the user should be able to talk to us */
+    dir = g_path_get_dirname(path);
+    mkdir(dir, 0700);
+    if (lstat(dir, &st) != 0 || !S_ISDIR(st.st_mode) ||
+	st.st_uid != getuid() || (st.st_mode & 077) != 0) {
+	nabi_log(1, "channel: unsafe directory: %s\n", dir);
+	g_free(dir);
+	return NULL;
+    }
+    g_free(dir);
+
+    fd = nabi_channel_socket(path, &addr);
+    if (fd < 0)
+	return NULL;
+
+    unlink(path);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+	listen(fd, 4) != 0) {
+	nabi_log(1, "channel: can't listen on %s: %s\n",
+		 path, g_strerror(errno));
+	close(fd);
+	return NULL;
+    }
+    nabi_channel_set_nonblock(fd);
+
+    channel = nabi_channel_new(context, func, data);
+    channel->path = g_strdup(path);
+    channel->fd = fd;
+    channel->accept_id = nabi_channel_add_watch(channel, fd, G_IO_IN,
+						nabi_channel_accept, channel);
+
+    nabi_log(1, "channel: listen on %s\n", path);
+
+    return channel;
+}
+
+NabiChannel*
+nabi_channel_connect(const char* path, GMainContext* context,
+		     NabiChannelFunc func, gpointer data)
+{
+    NabiChannel* channel;
+    struct sockaddr_un addr;
+    int fd;
+
+    fd = nabi_channel_socket(path, &addr);
+    if (fd < 0)
+	return NULL;
+
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+	nabi_log(3, "channel: can't connect to %s: %s\n",
+		 path, g_strerror(errno));
+	close(fd);
+	return NULL;
+    }
+
+    channel = nabi_channel_new(context, func, data);
+    nabi_channel_peer_new(channel, fd);
+
+    nabi_log(1, "channel: connected to %s\n", path);
+
+    return channel;
+}
+
+void
+nabi_channel_destroy(NabiChannel* channel)
+{
+    if (channel == NULL)
+	return;
+
+    while (channel->peers != NULL)
+	nabi_channel_peer_free((NabiChannelPeer*)channel->peers->data);
+
+    if (channel->fd >= 0) {
+	nabi_channel_remove_watch(channel, channel->accept_id);
+	close(channel->fd);
+	unlink(channel->path);
+    }
+    g_free(channel->path);
+
+    g_ptr_array_foreach(channel->names, (GFunc)g_free, NULL);
+    g_ptr_array_free(channel->names, TRUE);
+    g_ptr_array_foreach(channel->values, (GFunc)g_free, NULL);
+    g_ptr_array_free(channel->values, TRUE);
+
+    g_free(channel);
+}
+
+gboolean
+nabi_channel_is_connected(NabiChannel* channel)
+{
+    return channel != NULL && channel->peers != NULL;
+}
+
+void
+nabi_channel_set(NabiChannel* channel, const char* name, const char* value)
+{
+    GSList* list;
+    gboolean changed;
+    gint i;
+
+    if (channel == NULL || name == NULL || value == NULL)
+	return;
+
+    i = nabi_channel_store(channel, name, value, &changed);
+    if (i < 0 || !changed)
+	return;
+
+    for (list = channel->peers; list != NULL; list = list->next)
+	nabi_channel_peer_mark((NabiChannelPeer*)list->data, 1U << i);
+}
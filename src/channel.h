@@ -0,0 +1,51 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifndef nabi_channel_h
+#define nabi_channel_h
+
+#include <glib.h>
+
+/* A unix socket between the xim server and the status ui, which may
+ * run in another process. Both sides keep a few named values, like
+ * "mode", "keyboard" and "hanja", and nabi_channel_set() sends the
+ * new value to the other side as a "name value" line.
+ *
+ * The sockets never block. A peer which does not read fast enough gets
+ * only the last value of each name, so the xim server never waits for
+ * the ui. The callback gets the lines from the other side, and a NULL
+ * name when a connection is closed. */
+typedef struct _NabiChannel NabiChannel;
+typedef void (*NabiChannelFunc)(NabiChannel* channel,
+				const char* name, const char* value,
+				gpointer data);
+
+char*        nabi_channel_get_path(const char* display_name,
+				   const char* xim_name);
+
+NabiChannel* nabi_channel_listen (const char* path, GMainContext* context,
+				  NabiChannelFunc func, gpointer data);
+NabiChannel* nabi_channel_connect(const char* path, GMainContext* context,
+				  NabiChannelFunc func, gpointer data);
+void         nabi_channel_destroy(NabiChannel* channel);
+gboolean     nabi_channel_is_connected(NabiChannel* channel);
+
+void         nabi_channel_set    (NabiChannel* channel,
+				  const char* name, const char* value);
+
+#endif /* nabi_channel_h */
@@ -67,6 +67,7 @@ const static struct config_item config_items[] = {
     { "candidate_font",	    CONFIG_STR,  OFFSET(candidate_font)           },
     { "candidate_format",   CONFIG_STR,  OFFSET(candidate_format)         },
     { "dynamic_event_flow", CONFIG_BOOL, OFFSET(use_dynamic_event_flow)   },
+    { "async_forward",      CONFIG_BOOL, OFFSET(use_async_forward)        },
     { "commit_by_word",     CONFIG_BOOL, OFFSET(commit_by_word)           },
     { "auto_reorder",       CONFIG_BOOL, OFFSET(auto_reorder)             },
     { "use_simplified_chinese", CONFIG_BOOL, OFFSET(use_simplified_chinese) },
@@ -214,6 +215,7 @@ nabi_config_new()
     config->preedit_bg = g_string_new("#FFFFFF");
 
     config->use_dynamic_event_flow = TRUE;
+    config->use_async_forward = FALSE;
     config->commit_by_word = FALSE;
     config->auto_reorder = TRUE;
     config->hanja_mode = FALSE;
@@ -47,6 +47,7 @@ struct _NabiConfig {
     GString*        default_input_mode;
     GString*        input_mode_scope;
     gboolean        use_dynamic_event_flow;
+    gboolean        use_async_forward;
     gboolean        commit_by_word;
     gboolean        auto_reorder;
     gboolean        use_simplified_chinese;
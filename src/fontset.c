@@ -29,12 +29,12 @@
 #include "gettext.h"
 #include "fontset.h"
 
-static GHashTable *fontset_hash = NULL;
+/* fontsets of all displays, a fontset is shared by the ics on the same
+ * display only */
 static GSList *fontset_list = NULL;
-static Display *_display = NULL;
 
 static NabiFontSet*
-nabi_fontset_new(const char *name)
+nabi_fontset_new(Display *display, const char *name)
 {
     XFontSet xfontset;
     XFontSetExtents* ext;
@@ -44,7 +44,7 @@ nabi_fontset_new(const char *name)
     char  *error_message;
 
     nabi_log(4, "create fontset: %s\n", name);
-    xfontset = XCreateFontSet(_display,
+    xfontset = XCreateFontSet(display,
                               name,
                               &missing_list,
                               &missing_list_count,
@@ -53,7 +53,7 @@ nabi_fontset_new(const char *name)
 	gchar *name2;
         XFreeStringList(missing_list);
 	name2 = g_strconcat(name, ",*", NULL);
-	xfontset = XCreateFontSet(_display,
+	xfontset = XCreateFontSet(display,
 				  name2,
 				  &missing_list,
 				  &missing_list_count,
@@ -73,13 +73,13 @@ nabi_fontset_new(const char *name)
     ext = XExtentsOfFontSet(xfontset);
 
     fontset = g_malloc(sizeof(NabiFontSet));
+    fontset->display = display;
     fontset->name = g_strdup(name);
     fontset->ref = 1;
     fontset->xfontset = xfontset;
     fontset->ascent = ABS(ext->max_logical_extent.y);
     fontset->descent = ext->max_logical_extent.height - fontset->ascent;
 
-    g_hash_table_insert(fontset_hash, fontset->name, fontset);
     fontset_list = g_slist_prepend(fontset_list, fontset);
 
     return fontset;
@@ -102,16 +102,32 @@ nabi_fontset_unref(NabiFontSet *fontset)
 
     fontset->ref--;
     if (fontset->ref <= 0) {
-	g_hash_table_remove(fontset_hash, fontset->name);
 	fontset_list = g_slist_remove(fontset_list, fontset);
 
 	nabi_log(4, "delete fontset: %s\n", fontset->name);
-	XFreeFontSet(_display, fontset->xfontset);
+	XFreeFontSet(fontset->display, fontset->xfontset);
 	g_free(fontset->name);
 	g_free(fontset);
     }
 }
 
+static NabiFontSet*
+nabi_fontset_find_by_name(Display *display, const char *name)
+{
+    NabiFontSet *fontset;
+    GSList *list;
+    list = fontset_list;
+
+    while (list != NULL) {
+	fontset = (NabiFontSet*)(list->data);
+	if (fontset->display == display && strcmp(fontset->name, name) == 0)
+	    return fontset;
+	list = list->next;
+    }
+
+    return NULL;
+}
+
 static NabiFontSet*
 nabi_fontset_find_by_xfontset(XFontSet xfontset)
 {
@@ -134,17 +150,13 @@ nabi_fontset_create(Display *display, const char *fontset_name)
 {
     NabiFontSet *nabi_fontset;
 
-    _display = display;
-    if (fontset_hash == NULL)
-	fontset_hash = g_hash_table_new(g_str_hash, g_str_equal);
-
-    nabi_fontset = g_hash_table_lookup(fontset_hash, fontset_name);
+    nabi_fontset = nabi_fontset_find_by_name(display, fontset_name);
     if (nabi_fontset != NULL) {
 	nabi_fontset_ref(nabi_fontset);
 	return nabi_fontset;
     }
 
-    nabi_fontset = nabi_fontset_new(fontset_name);
+    nabi_fontset = nabi_fontset_new(display, fontset_name);
 
     return nabi_fontset;
 }
@@ -154,7 +166,6 @@ nabi_fontset_free(Display *display, XFontSet xfontset)
 {
     NabiFontSet *nabi_fontset;
 
-    _display = display;
     nabi_fontset = nabi_fontset_find_by_xfontset(xfontset);
     nabi_fontset_unref(nabi_fontset);
 }
@@ -164,25 +175,22 @@ nabi_fontset_free_all(Display *display)
 {
     NabiFontSet *fontset;
     GSList *list;
-    _display = display;
-
-    if (fontset_list != NULL) {
-	nabi_log(1, "remaining fontsets will be freed,"
-		 "this must be an error\n");
-	list = fontset_list;
-	while (list != NULL) {
-	    fontset = (NabiFontSet*)(list->data);
-	    XFreeFontSet(_display, fontset->xfontset);
+    GSList *next;
+
+    list = fontset_list;
+    while (list != NULL) {
+	next = list->next;
+	fontset = (NabiFontSet*)(list->data);
+	if (fontset->display == display) {
+	    nabi_log(1, "remaining fontset will be freed, "
+		     "this must be an error: %s\n", fontset->name);
+	    fontset_list = g_slist_delete_link(fontset_list, list);
+	    XFreeFontSet(fontset->display, fontset->xfontset);
 	    g_free(fontset->name);
 	    g_free(fontset);
-	    list = list->next;
 	}
+	list = next;
     }
-
-    if (fontset_hash != NULL)
-	g_hash_table_destroy(fontset_hash);
-    if (fontset_list != NULL)
-	g_slist_free(fontset_list);
 }
 
 /* vim: set ts=8 sw=4 : */
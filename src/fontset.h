@@ -20,6 +20,7 @@
 #define _FONTSET_H
 
 struct _NabiFontSet {
+    Display *display;
     XFontSet xfontset;
     char *name;
     int ascent;
@@ -22,16 +22,16 @@
 
 #include <stdio.h>
 #include <stddef.h>
+#include <string.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/keysym.h>
-#include <gtk/gtk.h>
+#include <glib.h>
 
 #include "../IMdkit/IMdkit.h"
 #include "../IMdkit/Xi18n.h"
 #include "ic.h"
 #include "server.h"
-#include "candidate.h"
 #include "debug.h"
 
 #include "xim_protocol.h"
@@ -48,7 +48,9 @@ get_xim_protocol_name(int code)
 static Bool
 nabi_handler_open(XIMS ims, IMOpenStruct *data)
 {
-    nabi_server_create_connection(nabi_server, 
+    NabiServer* server = nabi_server_get_by_xims(ims);
+
+    nabi_server_create_connection(server, 
 				  data->connect_id, data->lang.name);
     nabi_log(1, "open connection: id = %d, lang = %s\n",
 	     (int)data->connect_id, data->lang.name);
@@ -58,20 +60,47 @@ nabi_handler_open(XIMS ims, IMOpenStruct *data)
 static Bool
 nabi_handler_close(XIMS ims, IMCloseStruct *data)
 {
-    nabi_server_destroy_connection(nabi_server, data->connect_id);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+
+    nabi_server_destroy_connection(server, data->connect_id);
 
     nabi_log(1, "close connection: id = %d\n", (int)data->connect_id);
     return True;
 }
 
+static Bool
+nabi_handler_encoding_negotiation(XIMS ims, IMEncodingNegotiationStruct *data)
+{
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiConnection* conn;
+    const char* encoding = "COMPOUND_TEXT";
+
+    if (data->enc_index >= 0)
+	encoding = data->encoding[data->enc_index].name;
+
+    conn = nabi_server_get_connection(server, data->connect_id);
+    if (conn != NULL)
+	conn->utf8 = strcmp(encoding, "UTF8_STRING") == 0;
+
+    nabi_log(1, "encoding negotiation: id = %d, encoding = %s\n",
+	     (int)data->connect_id, encoding);
+    return True;
+}
+
 static Bool
 nabi_handler_create_ic(XIMS ims, IMChangeICStruct *data)
 {
+    NabiServer* server = nabi_server_get_by_xims(ims);
     NabiConnection* conn;
 
-    conn = nabi_server_get_connection(nabi_server, data->connect_id);
+    conn = nabi_server_get_connection(server, data->connect_id);
     if (conn != NULL) {
 	NabiIC *ic = nabi_connection_create_ic(conn, data);
+	if (ic == NULL) {
+	    nabi_log(1, "create ic: no more ic id for connection %d\n",
+		     (int)data->connect_id);
+	    return False;
+	}
 	data->icid = nabi_ic_get_id(ic);
 	nabi_log(1, "create ic: id = %d-%d, style = 0x%x\n",
 		 (int)data->connect_id, (int)data->icid, ic->input_style);
@@ -82,9 +111,10 @@ nabi_handler_create_ic(XIMS ims, IMChangeICStruct *data)
 static Bool
 nabi_handler_destroy_ic(XIMS ims, IMChangeICStruct *data)
 {
+    NabiServer* server = nabi_server_get_by_xims(ims);
     NabiConnection* conn;
 
-    conn = nabi_server_get_connection(nabi_server, data->connect_id);
+    conn = nabi_server_get_connection(server, data->connect_id);
     if (conn != NULL) {
 	NabiIC *ic = nabi_connection_get_ic(conn, data->icid);
 	if (ic != NULL) {
@@ -99,7 +129,8 @@ nabi_handler_destroy_ic(XIMS ims, IMChangeICStruct *data)
 static Bool
 nabi_handler_set_ic_values(XIMS ims, IMChangeICStruct *data)
 {
-    NabiIC *ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC *ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "set values: id = %d-%d\n",
 	     (int)data->connect_id, (int)data->icid);
@@ -111,7 +142,8 @@ nabi_handler_set_ic_values(XIMS ims, IMChangeICStruct *data)
 static Bool
 nabi_handler_get_ic_values(XIMS ims, IMChangeICStruct *data)
 {
-    NabiIC *ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC *ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "get values: id = %d-%d\n",
 	     (int)data->connect_id, (int)data->icid);
@@ -120,9 +152,29 @@ nabi_handler_get_ic_values(XIMS ims, IMChangeICStruct *data)
     return True;
 }
 
+static void
+nabi_handler_forward_to_client(XIMS ims, IMForwardEventStruct *data)
+{
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiConnection* conn;
+
+    /* IMdkit falls back to the synchronous XIM_FORWARD_EVENT if the
+     * client did not negotiate XIM_EXT_FORWARD_KEYEVENT. Xlib never
+     * does, so async_forward is off by default and only matters for
+     * clients which query the extension themselves. */
+    conn = nabi_server_get_connection(server, data->connect_id);
+    if (conn != NULL && conn->async_forward)
+	data->sync_bit = 0;
+    else
+	data->sync_bit = 1;
+
+    IMForwardEvent(ims, (XPointer)data);
+}
+
 static Bool
 nabi_handler_forward_event(XIMS ims, IMForwardEventStruct *data)
 {
+    NabiServer* server = nabi_server_get_by_xims(ims);
     NabiIC* ic;
     KeySym keysym;
     XKeyEvent *kevent;
@@ -130,11 +182,11 @@ nabi_handler_forward_event(XIMS ims, IMForwardEventStruct *data)
     if (data->event.type != KeyPress) {
 	nabi_log(4, "process event: id = %d-%d, key release\n",
 		    (int)data->connect_id, (int)data->icid);
-	IMForwardEvent(ims, (XPointer)data);
+	nabi_handler_forward_to_client(ims, data);
 	return True;
     }
 
-    ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    ic = nabi_server_get_ic(server, data->connect_id, data->icid);
     if (ic == NULL)
 	return True;
 
@@ -151,15 +203,15 @@ nabi_handler_forward_event(XIMS ims, IMForwardEventStruct *data)
 	    nabi_ic_preedit_done(ic);
 	    nabi_ic_status_done(ic);
 	}
-	if (nabi_server_is_trigger_key(nabi_server, keysym, kevent->state)) {
+	if (nabi_server_is_trigger_key(server, keysym, kevent->state)) {
 	    /* change input mode to compose mode */
 	    nabi_ic_set_mode(ic, NABI_INPUT_MODE_COMPOSE);
 	    return True;
 	}
 
-	IMForwardEvent(ims, (XPointer)data);
+	nabi_handler_forward_to_client(ims, data);
     } else {
-	if (nabi_server_is_trigger_key(nabi_server, keysym, kevent->state)) {
+	if (nabi_server_is_trigger_key(server, keysym, kevent->state)) {
 	    /* change input mode to direct mode */
 	    nabi_ic_set_mode(ic, NABI_INPUT_MODE_DIRECT);
 	    return True;
@@ -170,7 +222,7 @@ nabi_handler_forward_event(XIMS ims, IMForwardEventStruct *data)
 	    nabi_ic_status_start(ic);
 	}
 	if (!nabi_ic_process_keyevent(ic, keysym, kevent->state))
-	    IMForwardEvent(ims, (XPointer)data);
+	    nabi_handler_forward_to_client(ims, data);
     }
 
     return True;
@@ -179,7 +231,8 @@ nabi_handler_forward_event(XIMS ims, IMForwardEventStruct *data)
 static Bool
 nabi_handler_set_ic_focus(XIMS ims, IMChangeFocusStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "set focus: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -195,7 +248,8 @@ nabi_handler_set_ic_focus(XIMS ims, IMChangeFocusStruct *data)
 static Bool
 nabi_handler_unset_ic_focus(XIMS ims, IMChangeFocusStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "unset focus: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -203,12 +257,9 @@ nabi_handler_unset_ic_focus(XIMS ims, IMChangeFocusStruct *data)
     if (ic == NULL)
 	    return True;
 
-    nabi_server_set_mode_info(nabi_server, NABI_MODE_INFO_NONE);
+    nabi_server_set_mode_info(server, NABI_MODE_INFO_NONE);
 
-    if (ic->candidate) {
-	nabi_candidate_delete(ic->candidate);
-	ic->candidate = NULL;
-    }
+    nabi_ic_close_candidate_window(ic);
 
     return True;
 }
@@ -216,7 +267,8 @@ nabi_handler_unset_ic_focus(XIMS ims, IMChangeFocusStruct *data)
 static Bool
 nabi_handler_reset_ic(XIMS ims, IMResetICStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "reset: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -231,7 +283,8 @@ nabi_handler_reset_ic(XIMS ims, IMResetICStruct *data)
 static Bool
 nabi_handler_trigger_notify(XIMS ims, IMTriggerNotifyStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "trigger notify: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -248,7 +301,8 @@ nabi_handler_trigger_notify(XIMS ims, IMTriggerNotifyStruct *data)
 static Bool
 nabi_handler_preedit_start_reply(XIMS ims, IMPreeditCBStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "preedit start reply: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -261,7 +315,8 @@ nabi_handler_preedit_start_reply(XIMS ims, IMPreeditCBStruct *data)
 static Bool
 nabi_handler_preedit_caret_reply(XIMS ims, IMPreeditCBStruct *data)
 {
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "preedit caret replay: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -274,8 +329,9 @@ nabi_handler_preedit_caret_reply(XIMS ims, IMPreeditCBStruct *data)
 static Bool
 nabi_handler_str_conversion_reply(XIMS ims, IMStrConvCBStruct *data)
 {
+    NabiServer* server = nabi_server_get_by_xims(ims);
     XIMStringConversionText *text;
-    NabiIC* ic = nabi_server_get_ic(nabi_server, data->connect_id, data->icid);
+    NabiIC* ic = nabi_server_get_ic(server, data->connect_id, data->icid);
 
     nabi_log(1, "string conversion reply: id = %d-%d\n",
 	    (int)data->connect_id, (int)data->icid);
@@ -293,7 +349,8 @@ nabi_handler_str_conversion_reply(XIMS ims, IMStrConvCBStruct *data)
 	    utf8 = g_locale_to_utf8(mbs, -1, NULL, NULL, NULL);
 	    g_free(mbs);
 	} else {
-	    utf8 = g_locale_to_utf8(text->string.mbs, -1, NULL, NULL, NULL);
+	    /* IMdkit gives us multibyte texts in UTF-8 */
+	    utf8 = g_strndup(text->string.mbs, text->length);
 	}
 
 	if (utf8 != NULL) {
@@ -306,6 +363,26 @@ nabi_handler_str_conversion_reply(XIMS ims, IMStrConvCBStruct *data)
     return True;
 }
 
+static Bool
+nabi_handler_ext_move(XIMS ims, IMMoveStruct *data)
+{
+    NabiServer* server = nabi_server_get_by_xims(ims);
+    NabiIC* ic;
+    XPoint spot;
+
+    ic = nabi_server_get_ic(server, data->connect_id, data->icid);
+    if (ic == NULL)
+	return True;
+
+    /* the spot is signed, but the protocol carries it as CARD16 */
+    spot.x = (short)data->x;
+    spot.y = (short)data->y;
+    nabi_log(5, "ext move: id = %d-%d, spot = %d,%d\n",
+	     (int)data->connect_id, (int)data->icid, spot.x, spot.y);
+    nabi_ic_move_spot(ic, &spot);
+    return True;
+}
+
 Bool
 nabi_handler(XIMS ims, IMProtocol *data)
 {
@@ -314,6 +391,8 @@ nabi_handler(XIMS ims, IMProtocol *data)
 	return nabi_handler_open(ims, &data->imopen);
     case XIM_CLOSE:
 	return nabi_handler_close(ims, &data->imclose);
+    case XIM_ENCODING_NEGOTIATION:
+	return nabi_handler_encoding_negotiation(ims, &data->encodingnego);
     case XIM_CREATE_IC:
 	return nabi_handler_create_ic(ims, &data->changeic);
     case XIM_DESTROY_IC:
@@ -338,6 +417,12 @@ nabi_handler(XIMS ims, IMProtocol *data)
 	return nabi_handler_preedit_caret_reply(ims, &data->preedit_callback);
     case XIM_STR_CONVERSION_REPLY:
 	return nabi_handler_str_conversion_reply(ims, &data->strconv_callback);
+    case XIM_EXTENSION:
+	if (data->any.minor_code == XIM_EXT_FORWARD_KEYEVENT)
+	    return nabi_handler_forward_event(ims, &data->forwardevent);
+	else if (data->any.minor_code == XIM_EXT_MOVE)
+	    return nabi_handler_ext_move(ims, &data->extmove);
+	break;
     default:
 	nabi_log(1, "Unhandled XIM Protocol: %s\n",
 		 get_xim_protocol_name(data->major_code));
@@ -21,6 +21,7 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
 #include <ctype.h>
@@ -29,9 +30,6 @@
 #include <X11/Xutil.h>
 #include <X11/keysym.h>
 
-#include <gtk/gtk.h>
-#include <gdk/gdkx.h>
-
 #include "gettext.h"
 #include "ic.h"
 #include "server.h"
@@ -39,10 +37,11 @@
 #include "debug.h"
 #include "util.h"
 #include "ustring.h"
+#ifndef NABI_XIM_ONLY
 #include "nabi.h"
+#endif
 #include "keyboard-layout.h"
 
-static void  nabi_ic_preedit_configure(NabiIC *ic);
 static char* nabi_ic_get_hic_preedit_string(NabiIC *ic);
 static char* nabi_ic_get_flush_string(NabiIC *ic);
 static void  nabi_ic_hic_on_translate(HangulInputContext* hic,
@@ -51,7 +50,6 @@ static bool  nabi_ic_hic_on_transition(HangulInputContext* hic,
 			 ucschar c, const ucschar* preedit, void* data);
 static Bool  nabi_ic_update_candidate_window(NabiIC *ic);
 
-
 static gboolean
 is_syllable_boundary(ucschar prev, ucschar next)
 {
@@ -127,13 +125,18 @@ strniequal(const char* a, const char* b, gsize n)
 }
 
 NabiConnection*
-nabi_connection_create(CARD16 id, const char* locale)
+nabi_connection_create(NabiServer* server, CARD16 id, const char* locale)
 {
     NabiConnection* conn;
 
     conn = g_new(NabiConnection, 1);
+    conn->server = server;
     conn->id = id;
-    conn->mode = nabi_server->default_input_mode;
+    conn->mode = server->default_input_mode;
+    /* the server option is sampled once, so changing it only affects
+     * connections opened afterwards */
+    conn->async_forward = server->async_forward;
+    conn->utf8 = False;
     conn->cd = (GIConv)-1;
     if (locale != NULL) {
 	char* encoding = strchr(locale, '.');
@@ -150,7 +153,8 @@ nabi_connection_create(CARD16 id, const char* locale)
     }
 
     conn->next_new_ic_id = 1;
-    conn->ic_list = NULL;
+    conn->ic_table = NULL;
+    conn->ic_table_size = 0;
     
     return conn;
 }
@@ -158,38 +162,81 @@ nabi_connection_create(CARD16 id, const char* locale)
 void
 nabi_connection_destroy(NabiConnection* conn)
 {
-    GSList* item;
+    guint i;
     
     if (conn->cd != (GIConv)-1)
 	g_iconv_close(conn->cd);
 
-    item = conn->ic_list;
-    while (item != NULL) {
-	if (item->data != NULL)
-	    nabi_ic_destroy((NabiIC*)item->data);
-	item = g_slist_next(item);
+    for (i = 1; i < conn->ic_table_size; i++) {
+	if (conn->ic_table[i] != NULL)
+	    nabi_ic_destroy(conn->ic_table[i]);
     }
-    g_slist_free(conn->ic_list);
+    g_free(conn->ic_table);
 
     g_free(conn);
 }
 
+/* ic id is an index to ic_table. We look for a free slot starting from
+ * next_new_ic_id so that an id is not reused right after it is freed, and
+ * grow the table only when all slots are in use. So the table stays as
+ * dense as the number of live ics, even after next_new_ic_id wraps. */
+static CARD16
+nabi_connection_alloc_ic_id(NabiConnection* conn)
+{
+    guint i, n, id;
+    guint size;
+
+    n = conn->ic_table_size > 0 ? conn->ic_table_size - 1 : 0;
+    id = conn->next_new_ic_id;
+    for (i = 0; i < n; i++) {
+	if (id == 0 || id >= conn->ic_table_size)
+	    id = 1;
+	if (conn->ic_table[id] == NULL)
+	    return id;
+	id++;
+    }
+
+    /* ic id is CARD16, so we can not have more than 65535 ics */
+    if (conn->ic_table_size >= G_MAXUINT16 + 1)
+	return 0;
+
+    size = conn->ic_table_size > 0 ? conn->ic_table_size * 2 : 16;
+    if (size > G_MAXUINT16 + 1)
+	size = G_MAXUINT16 + 1;
+
+    conn->ic_table = g_renew(NabiIC*, conn->ic_table, size);
+    for (i = conn->ic_table_size; i < size; i++)
+	conn->ic_table[i] = NULL;
+
+    id = conn->ic_table_size > 0 ? conn->ic_table_size : 1;
+    conn->ic_table_size = size;
+
+    return id;
+}
+
 NabiIC*
 nabi_connection_create_ic(NabiConnection* conn, IMChangeICStruct* data)
 {
+    static guint next_generation = 1;
     NabiIC* ic; 
+    CARD16 id;
 
     if (conn == NULL)
 	return NULL;
 
+    id = nabi_connection_alloc_ic_id(conn);
+    if (id == 0)
+	return NULL;
+
     ic = nabi_ic_create(conn, data);
-    ic->id = conn->next_new_ic_id;
+    ic->id = id;
+    ic->generation = next_generation++;
 
-    conn->next_new_ic_id++;
+    conn->next_new_ic_id = id + 1;
     if (conn->next_new_ic_id == 0)
 	conn->next_new_ic_id++;
 
-    conn->ic_list = g_slist_prepend(conn->ic_list, ic);
+    conn->ic_table[id] = ic;
     return ic;
 }
 
@@ -199,26 +246,18 @@ nabi_connection_destroy_ic(NabiConnection* conn, NabiIC* ic)
     if (conn == NULL || ic == NULL)
 	return;
 
-    conn->ic_list = g_slist_remove(conn->ic_list, ic);
+    if (ic->id < conn->ic_table_size && conn->ic_table[ic->id] == ic)
+	conn->ic_table[ic->id] = NULL;
     nabi_ic_destroy(ic);
 }
 
 NabiIC*
 nabi_connection_get_ic(NabiConnection* conn, CARD16 id)
 {
-    GSList* item;
-    if (conn == NULL || id == 0)
+    if (conn == NULL || id == 0 || id >= conn->ic_table_size)
 	return NULL;
 
-    item = conn->ic_list;
-    while (item != NULL) {
-	NabiIC* ic = (NabiIC*)item->data;
-	if (ic->id == id)
-	    return ic;
-	item = g_slist_next(item);
-    }
-
-    return NULL;
+    return conn->ic_table[id];
 }
 
 gboolean
@@ -251,12 +290,13 @@ nabi_connection_is_valid_str(NabiConnection* conn, const char* str)
 }
 
 NabiToplevel*
-nabi_toplevel_new(Window id)
+nabi_toplevel_new(NabiServer* server, Window id)
 {
     NabiToplevel* toplevel = g_new(NabiToplevel, 1);
 
+    toplevel->server = server;
     toplevel->id = id;
-    toplevel->mode = nabi_server->default_input_mode;
+    toplevel->mode = server->default_input_mode;
     toplevel->ref = 1;
 
     return toplevel;
@@ -275,7 +315,7 @@ nabi_toplevel_unref(NabiToplevel* toplevel)
     if (toplevel != NULL) {
 	toplevel->ref--;
 	if (toplevel->ref <= 0) {
-	    nabi_server_remove_toplevel(nabi_server, toplevel);
+	    nabi_server_remove_toplevel(toplevel->server, toplevel);
 	    g_free(toplevel);
 	}
     }
@@ -290,7 +330,7 @@ nabi_ic_init_values(NabiIC *ic)
     ic->resource_name = NULL;
     ic->resource_class = NULL;
 
-    ic->mode = nabi_server->default_input_mode;
+    ic->mode = ic->server->default_input_mode;
 
     /* preedit attr */
     ic->preedit.str = ustring_new();
@@ -308,10 +348,8 @@ nabi_ic_init_values(NabiIC *ic)
     ic->preedit.spot.x = 0;
     ic->preedit.spot.y = 0;
     ic->preedit.cmap = 0;
-    ic->preedit.normal_gc = NULL;
-    ic->preedit.hilight_gc = NULL;
-    ic->preedit.foreground = nabi_server->preedit_fg.pixel;
-    ic->preedit.background = nabi_server->preedit_bg.pixel;
+    ic->preedit.foreground = ic->server->preedit_fg.pixel;
+    ic->preedit.background = ic->server->preedit_bg.pixel;
     ic->preedit.bg_pixmap = 0;
     ic->preedit.cursor = 0;
     ic->preedit.base_font = NULL;
@@ -322,9 +360,12 @@ nabi_ic_init_values(NabiIC *ic)
     ic->preedit.state = XIMPreeditEnable;
     ic->preedit.start = False;
     ic->preedit.prev_length = 0;
+    ic->preedit.drawn = ustring_new();
+    ic->preedit.drawn_feedback = g_array_new(FALSE, FALSE, sizeof(XIMFeedback));
     ic->preedit.has_start_cb = FALSE;
     ic->preedit.has_draw_cb = FALSE;
     ic->preedit.has_done_cb = FALSE;
+    ic->preedit.configure_pending = FALSE;
 
     /* status attributes */
     ic->status.area.x = 0;
@@ -346,7 +387,7 @@ nabi_ic_init_values(NabiIC *ic)
     ic->status.cursor = 0;
     ic->status.base_font = NULL;
 
-    ic->candidate = NULL;
+    ic->has_candidate = False;
 
     ic->toplevel = NULL;
 
@@ -356,11 +397,9 @@ nabi_ic_init_values(NabiIC *ic)
     ic->wait_for_client_text = FALSE;
     ic->has_str_conv_cb = FALSE;
 
-    ic->hic = hangul_ic_new(nabi_server->hangul_keyboard);
-    hangul_ic_connect_callback(ic->hic, "translate",
-			       nabi_ic_hic_on_translate, ic);
-    hangul_ic_connect_callback(ic->hic, "transition",
-			       nabi_ic_hic_on_transition, ic);
+    /* nabi_ic_get_hic() takes one from the server on demand */
+    ic->hic = NULL;
+    ic->hic_keyboard = NULL;
 }
 
 NabiIC*
@@ -368,6 +407,7 @@ nabi_ic_create(NabiConnection* conn, IMChangeICStruct *data)
 {
     NabiIC *ic = g_new(NabiIC, 1);
 
+    ic->server = conn->server;
     ic->connection = conn;
 
     nabi_ic_init_values(ic);
@@ -395,31 +435,29 @@ nabi_ic_destroy(NabiIC *ic)
 	g_array_free(ic->preedit.str, TRUE);
 	ic->preedit.str = NULL;
     }
+    if (ic->preedit.drawn != NULL) {
+	ustring_delete(ic->preedit.drawn);
+	ic->preedit.drawn = NULL;
+    }
+    if (ic->preedit.drawn_feedback != NULL) {
+	g_array_free(ic->preedit.drawn_feedback, TRUE);
+	ic->preedit.drawn_feedback = NULL;
+    }
 
     /* destroy preedit window */
-    if (ic->preedit.window != NULL)
-	gdk_window_destroy(ic->preedit.window);
+    if (ic->preedit.window != NULL) {
+	nabi_preedit_window_destroy(ic->preedit.window);
+	ic->preedit.window = NULL;
+    }
 
     /* destroy fontset */
     if (ic->preedit.font_set != NULL) {
-	nabi_fontset_free(nabi_server->display, ic->preedit.font_set);
+	nabi_fontset_free(ic->server->display, ic->preedit.font_set);
 	ic->preedit.font_set = NULL;
     }
 
-    if (ic->preedit.normal_gc != NULL) {
-	g_object_unref(G_OBJECT(ic->preedit.normal_gc));
-	ic->preedit.normal_gc = NULL;
-    }
-
-    if (ic->preedit.hilight_gc != NULL) {
-	g_object_unref(G_OBJECT(ic->preedit.hilight_gc));
-	ic->preedit.hilight_gc = NULL;
-    }
-
-    if (ic->candidate != NULL) {
-	nabi_candidate_delete(ic->candidate);
-	ic->candidate = NULL;
-    }
+    if (ic->has_candidate)
+	nabi_ic_close_candidate_window(ic);
 
     if (ic->client_text != NULL) {
 	g_array_free(ic->client_text, TRUE);
@@ -432,9 +470,10 @@ nabi_ic_destroy(NabiIC *ic)
     }
 
     if (ic->hic != NULL) {
-	hangul_ic_delete(ic->hic);
+	nabi_server_put_hic(ic->server, ic->hic_keyboard, ic->hic);
 	ic->hic = NULL;
     }
+    g_free(ic->hic_keyboard);
 
     g_free(ic);
 }
@@ -448,6 +487,15 @@ nabi_ic_get_id(NabiIC* ic)
     return ic->id;
 }
 
+void
+nabi_ic_get_handle(NabiIC* ic, NabiICHandle* handle)
+{
+    handle->server = ic->server;
+    handle->connect_id = ic->connection->id;
+    handle->id = ic->id;
+    handle->generation = ic->generation;
+}
+
 Bool
 nabi_ic_is_empty(NabiIC *ic)
 {
@@ -457,26 +505,58 @@ nabi_ic_is_empty(NabiIC *ic)
     return hangul_ic_is_empty(ic->hic);
 }
 
+static void
+nabi_ic_set_hic_output_mode(NabiIC *ic)
+{
+    if (ic->server->output_mode == NABI_OUTPUT_JAMO) {
+	hangul_ic_set_output_mode(ic->hic, HANGUL_OUTPUT_JAMO);
+    } else {
+	hangul_ic_set_output_mode(ic->hic, HANGUL_OUTPUT_SYLLABLE);
+    }
+}
+
+static HangulInputContext*
+nabi_ic_get_hic(NabiIC *ic)
+{
+    if (ic->hic != NULL)
+	return ic->hic;
+
+    ic->hic = nabi_server_get_hic(ic->server, ic->server->hangul_keyboard);
+    ic->hic_keyboard = g_strdup(ic->server->hangul_keyboard);
+    hangul_ic_connect_callback(ic->hic, "translate",
+			       nabi_ic_hic_on_translate, ic);
+    hangul_ic_connect_callback(ic->hic, "transition",
+			       nabi_ic_hic_on_transition, ic);
+    nabi_ic_set_hic_output_mode(ic);
+
+    return ic->hic;
+}
+
+/* called on every focus in, the keyboard is selected only when it has
+ * been changed */
 void
 nabi_ic_set_hangul_keyboard(NabiIC *ic, const char* hangul_keyboard)
 {
     if (ic == NULL || ic->hic == NULL)
 	return;
 
-    hangul_ic_select_keyboard(ic->hic, hangul_keyboard);
-
-    if (nabi_server->output_mode == NABI_OUTPUT_JAMO) {
-	hangul_ic_set_output_mode(ic->hic, HANGUL_OUTPUT_JAMO);
-    } else {
-	hangul_ic_set_output_mode(ic->hic, HANGUL_OUTPUT_SYLLABLE);
+    if (hangul_keyboard == NULL || ic->hic_keyboard == NULL ||
+	strcmp(hangul_keyboard, ic->hic_keyboard) != 0) {
+	hangul_ic_select_keyboard(ic->hic, hangul_keyboard);
+	g_free(ic->hic_keyboard);
+	ic->hic_keyboard = g_strdup(hangul_keyboard);
     }
+
+    nabi_ic_set_hic_output_mode(ic);
 }
 
 static void
 nabi_ic_hic_on_translate(HangulInputContext* hic,
                          int ascii, ucschar* c, void* data)
 {
-    nabi_server_log_key(nabi_server, *c, 0);
+    NabiIC* ic = (NabiIC*)data;
+
+    nabi_server_log_key(ic->server, *c, 0);
 }
 
 static bool
@@ -486,7 +566,7 @@ nabi_ic_hic_on_transition(HangulInputContext* hic,
     bool ret = true;
     NabiIC* ic = (NabiIC*)data;
 
-    if (!nabi_server->auto_reorder) {
+    if (!ic->server->auto_reorder) {
 	if (hangul_is_choseong(c)) {
 	    if (hangul_ic_has_jungseong(hic) || hangul_ic_has_jongseong(hic)) {
 		return false;
@@ -510,94 +590,6 @@ nabi_ic_hic_on_transition(HangulInputContext* hic,
     return ret;
 }
 
-static PangoLayout*
-nabi_ic_create_pango_layout(NabiIC *ic, const char* text)
-{
-    GdkScreen* screen;
-    PangoContext* context;
-    PangoLayout* layout;
-
-    screen = gdk_drawable_get_screen(ic->preedit.window);
-    context = gdk_pango_context_get_for_screen(screen);
-
-    pango_context_set_font_description(context, nabi_server->preedit_font);
-    pango_context_set_base_dir(context, PANGO_DIRECTION_LTR);
-    pango_context_set_language(context, pango_language_from_string("ko"));
-
-    layout = pango_layout_new(context);
-    if (text != NULL)
-	pango_layout_set_text(layout, text, -1);
-
-    return layout;
-}
-
-static void
-nabi_ic_preedit_gdk_draw_string(NabiIC *ic, char *preedit,
-				char* normal, char* hilight)
-{
-    GdkGC *normal_gc;
-    GdkGC *hilight_gc;
-    PangoContext *context;
-    const PangoFontDescription *desc;
-    PangoFontMetrics *metrics;
-    int ascent;
-    PangoLayout *normal_l;
-    PangoLayout *hilight_l;
-    PangoRectangle normal_r = { 0, 0, 12, 12 };
-    PangoRectangle hilight_r = { 0, 0, 12, 12 };
-    GdkColor fg, bg;
-    GdkColormap* colormap;
-
-    if (ic->preedit.window == NULL)
-	return;
-
-    normal_gc = ic->preedit.normal_gc;
-    hilight_gc = ic->preedit.hilight_gc;
-
-    normal_l = nabi_ic_create_pango_layout(ic, normal);
-    pango_layout_get_pixel_extents(normal_l, NULL, &normal_r);
-
-    hilight_l = nabi_ic_create_pango_layout(ic, hilight);
-    pango_layout_get_pixel_extents(hilight_l, NULL, &hilight_r);
-
-    fg = nabi_server->preedit_fg;
-    bg = nabi_server->preedit_bg;
-    colormap = gdk_drawable_get_colormap(ic->preedit.window);
-    if (colormap != NULL) {
-	gdk_colormap_query_color(colormap, ic->preedit.foreground, &fg);
-	gdk_colormap_query_color(colormap, ic->preedit.background, &bg);
-    }
-
-    context = pango_layout_get_context(hilight_l);
-    desc = pango_layout_get_font_description(hilight_l);
-    metrics = pango_context_get_metrics(context, desc,
-				 pango_language_from_string("ko"));
-
-    ascent = pango_font_metrics_get_ascent(metrics);
-    ic->preedit.ascent = PANGO_PIXELS(ascent);
-    ic->preedit.descent = normal_r.height - ic->preedit.ascent;
-
-    ic->preedit.width = normal_r.width + hilight_r.height + 3;
-    ic->preedit.height = MAX(normal_r.height, hilight_r.height) + 3;
-    nabi_ic_preedit_configure(ic);
-
-    gdk_window_clear(ic->preedit.window);
-
-    gdk_draw_layout_with_colors(ic->preedit.window, normal_gc,
-				1, 1, normal_l, &fg, &bg);
-    gdk_draw_layout_with_colors(ic->preedit.window, hilight_gc,
-				1 + normal_r.width, 1, hilight_l, &bg, &fg);
-
-    if (normal_r.width > 0) {
-	int w = normal_r.width + hilight_r.width;
-	int h = MAX(normal_r.height, hilight_r.height);
-	gdk_draw_line(ic->preedit.window, normal_gc, 1, h, 1 + w, h);
-    }
-
-    g_object_unref(G_OBJECT(normal_l));
-    g_object_unref(G_OBJECT(hilight_l));
-}
-
 static void
 nabi_ic_preedit_x11_draw_string(NabiIC *ic, char* preedit,
 			    char *normal, char* hilight)
@@ -621,9 +613,9 @@ nabi_ic_preedit_x11_draw_string(NabiIC *ic, char* preedit,
     if (ic->preedit.font_set == 0)
 	return;
 
-    drawable = GDK_WINDOW_XWINDOW(ic->preedit.window);
-    normal_gc = gdk_x11_gc_get_xgc(ic->preedit.normal_gc);
-    hilight_gc = gdk_x11_gc_get_xgc(ic->preedit.hilight_gc);
+    drawable = nabi_preedit_window_get_xid(ic->preedit.window);
+    normal_gc = nabi_preedit_window_get_gc(ic->preedit.window, FALSE);
+    hilight_gc = nabi_preedit_window_get_gc(ic->preedit.window, TRUE);
     fontset = ic->preedit.font_set;
 
     normal_size = strlen(normal);
@@ -654,21 +646,21 @@ nabi_ic_preedit_x11_draw_string(NabiIC *ic, char* preedit,
 	int offset;
 
 	offset = XmbTextEscapement(fontset, normal_mb, normal_size);
-	XmbDrawImageString(nabi_server->display,
+	XmbDrawImageString(ic->server->display,
 			   drawable, fontset, normal_gc,
 			   x, ic->preedit.ascent,
 			   normal_mb, normal_size);
 	if (hilight_size > 0) {
-	    XmbDrawImageString(nabi_server->display,
+	    XmbDrawImageString(ic->server->display,
 			       drawable, fontset, hilight_gc,
 			       x + offset, ic->preedit.ascent,
 			       hilight_mb, hilight_size);
 	}
 
-	XDrawLine(nabi_server->display, drawable, normal_gc,
+	XDrawLine(ic->server->display, drawable, normal_gc,
 		  x, rect.height, x + rect.width, rect.height);
     } else {
-	XmbDrawImageString(nabi_server->display,
+	XmbDrawImageString(ic->server->display,
 			   drawable, fontset, hilight_gc,
 			   0, ic->preedit.ascent,
 			   preedit_mb, preedit_size);
@@ -679,6 +671,17 @@ nabi_ic_preedit_x11_draw_string(NabiIC *ic, char* preedit,
     g_free(hilight_mb);
 }
 
+/* draws with the font of the server, not the one of the client */
+static void
+nabi_ic_preedit_draw_string(NabiIC *ic, char* preedit,
+			    char *normal, char* hilight)
+{
+    if (ic->preedit.window == NULL)
+	return;
+
+    nabi_preedit_window_draw_string(ic->preedit.window, ic, normal, hilight);
+}
+
 static void
 nabi_ic_preedit_draw(NabiIC *ic)
 {
@@ -691,15 +694,15 @@ nabi_ic_preedit_draw(NabiIC *ic)
     preedit = g_strconcat(normal, hilight, NULL);
 
     if (ic->input_style & XIMPreeditPosition) {
-	if (!nabi_server->ignore_app_fontset &&
+	if (!ic->server->ignore_app_fontset &&
 	    ic->preedit.font_set != NULL)
 	    nabi_ic_preedit_x11_draw_string(ic, preedit, normal, hilight);
 	else
-	    nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	    nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     } else if (ic->input_style & XIMPreeditArea) {
-	nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     } else if (ic->input_style & XIMPreeditNothing) {
-	nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     }
 
     g_free(preedit);
@@ -721,7 +724,7 @@ nabi_ic_preedit_show(NabiIC *ic)
 
     /* draw preedit only when ic have any hangul data */
     if (!nabi_ic_is_empty(ic))
-	gdk_window_show(ic->preedit.window);
+	nabi_preedit_window_show(ic->preedit.window);
 }
 
 /* unmap preedit window */
@@ -734,16 +737,16 @@ nabi_ic_preedit_hide(NabiIC *ic)
     nabi_log(4, "hide preedit window: id = %d-%d\n",
 	     ic->connection->id, ic->id);
 
-    if (gdk_window_is_visible(ic->preedit.window))
-	gdk_window_hide(ic->preedit.window);
+    nabi_preedit_window_hide(ic->preedit.window);
 }
 
 /* move and resize preedit window */
-static void
+void
 nabi_ic_preedit_configure(NabiIC *ic)
 {
     int x = 0, y = 0, w = 1, h = 1;
 
+    ic->preedit.configure_pending = FALSE;
     if (ic->preedit.window == NULL)
 	return;
 
@@ -771,143 +774,88 @@ nabi_ic_preedit_configure(NabiIC *ic)
     }
 
     nabi_log(5, "configure preedit window: %d,%d %dx%d\n", x, y, w, h);
-    gdk_window_move_resize(ic->preedit.window, x, y, w, h);
+    nabi_preedit_window_move_resize(ic->preedit.window, x, y, w, h);
 }
 
-static GdkFilterReturn
-gdk_event_filter(GdkXEvent *xevent, GdkEvent *gevent, gpointer data)
-{
-    XEvent *event = (XEvent*)xevent;
-    guint connect_id = GPOINTER_TO_UINT(data) >> 16;
-    guint ic_id = GPOINTER_TO_UINT(data) & 0xFFFF;
-    NabiIC *ic = nabi_server_get_ic(nabi_server, connect_id, ic_id);
-
-    if (ic == NULL)
-	return GDK_FILTER_REMOVE;
+typedef struct {
+    NabiServer* server;
+    guint  connect_id;
+    guint  ic_id;
+    Window window;
+    int    type;
+} NabiPreeditEvent;
 
-    if (ic->preedit.window == NULL)
-	return GDK_FILTER_REMOVE;
+/* the backend reads the events of the preedit windows on the ui side,
+ * the ic handles them on the xim side */
+static void
+nabi_ic_preedit_event_cb(gpointer data)
+{
+    NabiPreeditEvent* event = (NabiPreeditEvent*)data;
+    NabiIC *ic = nabi_server_get_ic(event->server, event->connect_id,
+				    event->ic_id);
+
+    if (ic != NULL && ic->preedit.window != NULL &&
+	event->window == nabi_preedit_window_get_xid(ic->preedit.window)) {
+	switch (event->type) {
+	case DestroyNotify:
+	    /* preedit window is destroyed, so we set it 0 */
+	    nabi_preedit_window_free(ic->preedit.window);
+	    ic->preedit.window = NULL;
+	    break;
+	case Expose:
+	    nabi_ic_preedit_draw(ic);
+	    break;
+	default:
+	    break;
+	}
+    }
 
-    if (event->xany.window != GDK_WINDOW_XWINDOW(ic->preedit.window))
-	return GDK_FILTER_CONTINUE;
+    g_free(event);
+}
 
-    switch (event->type) {
-    case DestroyNotify:
-	/* preedit window is destroyed, so we set it 0 */
-	ic->preedit.window = NULL;
-	return GDK_FILTER_REMOVE;
-	break;
-    case Expose:
-	//g_print("Redraw Window\n");
-	nabi_ic_preedit_draw(ic);
-	break;
-    default:
-	//g_print("event type: %d\n", event->type);
-	break;
-    }
+void
+nabi_ic_preedit_window_event(NabiServer* server,
+			     guint connect_id, guint ic_id,
+			     Window window, int type)
+{
+    NabiPreeditEvent* event;
 
-    return GDK_FILTER_CONTINUE;
+    event = g_new(NabiPreeditEvent, 1);
+    event->server = server;
+    event->connect_id = connect_id;
+    event->ic_id = ic_id;
+    event->window = window;
+    event->type = type;
+    nabi_server_call_xim(server, nabi_ic_preedit_event_cb, event, g_free);
 }
 
 static void
 nabi_ic_preedit_window_new(NabiIC *ic)
 {
-    GdkWindow *parent = NULL;
-    GdkWindowAttr attr;
-    gint mask;
-    guint connect_id;
-    guint ic_id;
-    GdkColor fg = { 0, 0, 0, 0 };
-    GdkColor bg = { 0, 0, 0, 0 };
+    if (ic->focus_window == 0 && ic->client_window == 0)
+	return;
 
     if (ic->focus_window != 0)
-	parent = gdk_window_foreign_new(ic->focus_window);
-    else if (ic->client_window != 0)
-	parent = gdk_window_foreign_new(ic->client_window);
+	ic->preedit.window = nabi_preedit_window_new(ic, ic->focus_window);
     else
-	return;
-
-    attr.wclass = GDK_INPUT_OUTPUT;
-    attr.event_mask = GDK_EXPOSURE_MASK | GDK_STRUCTURE_MASK;
-    attr.window_type = GDK_WINDOW_TEMP;
-    attr.x = ic->preedit.spot.x;
-    attr.y = ic->preedit.spot.y - ic->preedit.ascent;
-    attr.width = ic->preedit.width;
-    attr.height = ic->preedit.height;
-    /* set override-redirect to true
-     * we should set this to show preedit window on qt apps */
-    attr.override_redirect = TRUE;
-    mask = GDK_WA_X | GDK_WA_Y | GDK_WA_NOREDIR;
-
-    ic->preedit.window = gdk_window_new(parent, &attr, mask);
-
-    fg.pixel = ic->preedit.foreground;
-    bg.pixel = ic->preedit.background;
-    gdk_window_set_background(ic->preedit.window, &bg);
-
-    if (ic->preedit.normal_gc != NULL)
-	g_object_unref(G_OBJECT(ic->preedit.normal_gc));
-
-    if (ic->preedit.hilight_gc != NULL)
-	g_object_unref(G_OBJECT(ic->preedit.hilight_gc));
-
-    ic->preedit.normal_gc = gdk_gc_new(ic->preedit.window);
-    gdk_gc_set_foreground(ic->preedit.normal_gc, &fg);
-    gdk_gc_set_background(ic->preedit.normal_gc, &bg);
-
-    ic->preedit.hilight_gc = gdk_gc_new(ic->preedit.window);
-    gdk_gc_set_foreground(ic->preedit.hilight_gc, &bg);
-    gdk_gc_set_background(ic->preedit.hilight_gc, &fg);
-
-    /* install our preedit window event filter */
-    connect_id = ic->connection->id;
-    ic_id = ic->id;
-    gdk_window_add_filter(ic->preedit.window,
-			  gdk_event_filter,
-			  GUINT_TO_POINTER(connect_id << 16 | ic_id));
-    g_object_unref(G_OBJECT(parent));
+	ic->preedit.window = nabi_preedit_window_new(ic, ic->client_window);
 }
 
 static void
 nabi_ic_set_client_window(NabiIC* ic, Window client_window)
 {
-    Status s;
     Window w;
-    Window root = None;
-    Window parent = None;
-    Window* children = NULL;
-    unsigned int  nchildren = 0;
 
     ic->client_window = client_window;
-    
-    w = client_window;
-    s = XQueryTree(nabi_server->display, w,
-		   &root, &parent, &children, &nchildren);
-    if (s) {
-	while (parent != root) {
-	    if (children != NULL) {
-		XFree(children);
-		children = NULL;
-	    }
 
-	    w = parent;
-	    s = XQueryTree(nabi_server->display, w,
-			   &root, &parent, &children, &nchildren);
-	    if (!s)
-		break;
-	}
-	if (children != NULL) {
-	    XFree(children);
-	    children = NULL;
-	}
-    }
+    w = nabi_server_get_toplevel_window(ic->server, client_window);
 
     nabi_log(3, "ic: %d-%d, toplevel: %x\n", ic->id, ic->connection->id, w);
 
     if (ic->toplevel != NULL)
 	nabi_toplevel_unref(ic->toplevel);
 
-    ic->toplevel = nabi_server_get_toplevel(nabi_server, w);
+    ic->toplevel = nabi_server_get_toplevel(ic->server, w);
 }
 
 static void
@@ -919,30 +867,19 @@ nabi_ic_set_focus_window(NabiIC *ic, Window focus_window)
 static void
 nabi_ic_set_preedit_foreground(NabiIC *ic, unsigned long foreground)
 {
-    GdkColor color = { foreground, 0, 0, 0 };
-
     ic->preedit.foreground = foreground;
 
-    if (ic->preedit.normal_gc != NULL)
-	gdk_gc_set_foreground(ic->preedit.normal_gc, &color);
-    if (ic->preedit.hilight_gc != NULL)
-	gdk_gc_set_background(ic->preedit.hilight_gc, &color);
+    if (ic->preedit.window != NULL)
+	nabi_preedit_window_set_foreground(ic->preedit.window, foreground);
 }
 
 static void
 nabi_ic_set_preedit_background(NabiIC *ic, unsigned long background)
 {
-    GdkColor color = { background, 0, 0, 0 };
-
     ic->preedit.background = background;
 
-    if (ic->preedit.normal_gc != NULL)
-	gdk_gc_set_background(ic->preedit.normal_gc, &color);
-    if (ic->preedit.hilight_gc != NULL)
-	gdk_gc_set_foreground(ic->preedit.hilight_gc, &color);
-
-    if (ic->preedit.window != 0)
-	gdk_window_set_background(ic->preedit.window, &color);
+    if (ic->preedit.window != NULL)
+	nabi_preedit_window_set_background(ic->preedit.window, background);
 }
 
 static void
@@ -958,9 +895,9 @@ nabi_ic_load_preedit_fontset(NabiIC *ic, char *font_name)
     nabi_free(ic->preedit.base_font);
     ic->preedit.base_font = strdup(font_name);
     if (ic->preedit.font_set)
-	nabi_fontset_free(nabi_server->display, ic->preedit.font_set);
+	nabi_fontset_free(ic->server->display, ic->preedit.font_set);
 
-    fontset = nabi_fontset_create(nabi_server->display, font_name);
+    fontset = nabi_fontset_create(ic->server->display, font_name);
     if (fontset == NULL)
 	return;
 
@@ -996,6 +933,19 @@ nabi_ic_set_spot(NabiIC *ic, XPoint *point)
 	nabi_ic_preedit_show(ic);
 }
 
+/* XIM_EXT_MOVE comes on every caret move, so we only record the spot
+ * here and move the window once for all the moves in a batch */
+void
+nabi_ic_move_spot(NabiIC *ic, const XPoint *point)
+{
+    ic->preedit.spot = *point;
+
+    if (!ic->preedit.configure_pending) {
+	ic->preedit.configure_pending = TRUE;
+	nabi_server_queue_preedit_configure(ic->server, ic);
+    }
+}
+
 static void
 nabi_ic_set_area(NabiIC *ic, XRectangle *rect)
 {
@@ -1015,8 +965,6 @@ nabi_ic_set_area(NabiIC *ic, XRectangle *rect)
 	nabi_ic_preedit_show(ic);
 }
 
-#define streql(x, y)	(strcmp((x), (y)) == 0)
-
 void
 nabi_ic_set_values(NabiIC *ic, IMChangeICStruct *data)
 {
@@ -1026,89 +974,149 @@ nabi_ic_set_values(NabiIC *ic, IMChangeICStruct *data)
     if (ic == NULL)
 	return;
 
+    /* IMdkit resolves the attribute names, so we do not compare strings
+     * here. The spot location is set on every caret move. */
     attr = data->ic_attr;
     for (i = 0; i < data->ic_attr_num; i++, attr++) {
-	if (streql(XNInputStyle, attr->name)) {
-	    CARD32 style = *(CARD32*)attr->value;
-	    ic->input_style = style;
-	} else if (streql(XNClientWindow, attr->name)) {
-	    Window w = *(CARD32*)attr->value;
-	    nabi_ic_set_client_window(ic, w);
-	} else if (streql(XNFocusWindow, attr->name)) {
-	    Window w = *(CARD32*)attr->value;
-	    nabi_ic_set_focus_window(ic, w);
-	} else if (streql(XNStringConversionCallback, attr->name)) {
+	if (attr->value == NULL)
+	    continue;
+
+	switch (attr->kind) {
+	case XimAttr_InputStyle:
+	    ic->input_style = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_ClientWindow:
+	    nabi_ic_set_client_window(ic, *(CARD32*)attr->value);
+	    break;
+	case XimAttr_FocusWindow:
+	    nabi_ic_set_focus_window(ic, *(CARD32*)attr->value);
+	    break;
+	case XimAttr_StringConversionCallback:
 	    ic->has_str_conv_cb = TRUE;
-	} else {
+	    break;
+	default:
 	    nabi_log(1, "set unknown ic attribute: %s\n", attr->name);
+	    break;
 	}
     }
     
     attr = data->preedit_attr;
     for (i = 0; i < data->preedit_attr_num; i++, attr++) {
-	if (streql(XNSpotLocation, attr->name)) {
-	    XPoint* point = (XPoint*)attr->value;
-	    nabi_ic_set_spot(ic, point);
-	} else if (streql(XNForeground, attr->name)) {
-	    CARD32 color = *(CARD32*)attr->value;
-	    nabi_ic_set_preedit_foreground(ic, color);
-	} else if (streql(XNBackground, attr->name)) {
-	    CARD32 color = *(CARD32*)attr->value;
-	    nabi_ic_set_preedit_background(ic, color);
-	} else if (streql(XNArea, attr->name)) {
-	    XRectangle* rect = (XRectangle*)attr->value;
-	    nabi_ic_set_area(ic, rect);
-	} else if (streql(XNLineSpace, attr->name)) {
-	    CARD32 line_space = *(CARD32*)attr->value;
-	    ic->preedit.line_space = line_space;
-	} else if (streql(XNPreeditState, attr->name)) {
-	    CARD32 state = *(CARD32*)attr->value;
-	    ic->preedit.state = state;
-	} else if (streql(XNFontSet, attr->name)) {
-	    char* fontset = (char*)attr->value;
-	    if (!nabi_server->ignore_app_fontset) {
-		nabi_ic_load_preedit_fontset(ic, fontset);
+	if (attr->value == NULL)
+	    continue;
+
+	switch (attr->kind) {
+	case XimAttr_SpotLocation:
+	    nabi_ic_set_spot(ic, (XPoint*)attr->value);
+	    break;
+	case XimAttr_Foreground:
+	    nabi_ic_set_preedit_foreground(ic, *(CARD32*)attr->value);
+	    break;
+	case XimAttr_Background:
+	    nabi_ic_set_preedit_background(ic, *(CARD32*)attr->value);
+	    break;
+	case XimAttr_Area:
+	    nabi_ic_set_area(ic, (XRectangle*)attr->value);
+	    break;
+	case XimAttr_LineSpace:
+	    ic->preedit.line_space = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_PreeditState:
+	    ic->preedit.state = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_FontSet:
+	    if (!ic->server->ignore_app_fontset) {
+		nabi_ic_load_preedit_fontset(ic, (char*)attr->value);
 	    }
 	    nabi_log(5, "set ic value: id = %d-%d, fontset = %s\n",
-		     ic->id, ic->connection->id, fontset);
-	} else if (streql(XNPreeditStartCallback, attr->name)) {
+		     ic->id, ic->connection->id, (char*)attr->value);
+	    break;
+	case XimAttr_PreeditStartCallback:
 	    ic->preedit.has_start_cb = TRUE;
-	} else if (streql(XNPreeditDrawCallback, attr->name)) {
+	    break;
+	case XimAttr_PreeditDrawCallback:
 	    ic->preedit.has_draw_cb = TRUE;
-	} else if (streql(XNPreeditDoneCallback, attr->name)) {
+	    break;
+	case XimAttr_PreeditDoneCallback:
 	    ic->preedit.has_done_cb = TRUE;
-	} else {
+	    break;
+	default:
 	    nabi_log(1, "set unknown preedit attribute: %s\n", attr->name);
+	    break;
 	}
     }
     
     attr = data->status_attr;
     for (i = 0; i < data->status_attr_num; i++, attr++) {
-	if (streql(XNArea, attr->name)) {
-	    XRectangle* rect = (XRectangle*)attr->value;
-	    ic->status.area = *rect;
-	} else if (streql(XNAreaNeeded, attr->name)) {
-	    XRectangle* rect = (XRectangle*)attr->value;
-	    ic->status.area_needed = *rect;
-	} else if (streql(XNForeground, attr->name)) {
-	    CARD32 color = *(CARD32*)attr->value;
-	    ic->status.foreground = color;
-	} else if (streql(XNBackground, attr->name)) {
-	    CARD32 color = *(CARD32*)attr->value;
-	    ic->status.background = color;
-	} else if (streql(XNLineSpace, attr->name)) {
-	    CARD32 line_space = *(CARD32*)attr->value;
-	    ic->status.line_space = line_space;
-	} else if (streql(XNFontSet, attr->name)) {
-	    char* fontset = (char*)attr->value;
+	if (attr->value == NULL)
+	    continue;
+
+	switch (attr->kind) {
+	case XimAttr_Area:
+	    ic->status.area = *(XRectangle*)attr->value;
+	    break;
+	case XimAttr_AreaNeeded:
+	    ic->status.area_needed = *(XRectangle*)attr->value;
+	    break;
+	case XimAttr_Foreground:
+	    ic->status.foreground = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_Background:
+	    ic->status.background = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_LineSpace:
+	    ic->status.line_space = *(CARD32*)attr->value;
+	    break;
+	case XimAttr_FontSet:
 	    g_free(ic->status.base_font);
-	    ic->status.base_font = g_strdup(fontset);
-	} else {
+	    ic->status.base_font = g_strdup((char*)attr->value);
+	    break;
+	default:
 	    nabi_log(1, "set unknown status attributes: %s\n", attr->name);
+	    break;
 	}
     }
 }
 
+/* values which fit in attr->small are stored there, IMdkit frees the
+ * others */
+static void
+nabi_ic_attr_set_card32(XICAttribute *attr, CARD32 value)
+{
+    attr->small.card = value;
+    attr->value = &attr->small;
+    attr->value_length = sizeof(CARD32);
+}
+
+static void
+nabi_ic_attr_set_point(XICAttribute *attr, const XPoint *point)
+{
+    attr->small.point = *point;
+    attr->value = &attr->small;
+    attr->value_length = sizeof(XPoint);
+}
+
+static void
+nabi_ic_attr_set_rect(XICAttribute *attr, const XRectangle *rect)
+{
+    attr->small.rect = *rect;
+    attr->value = &attr->small;
+    attr->value_length = sizeof(XRectangle);
+}
+
+static void
+nabi_ic_attr_set_string(XICAttribute *attr, const char *str)
+{
+    if (str == NULL)
+	str = "";
+    attr->value_length = strlen(str) + 1;
+    attr->value = malloc(attr->value_length);
+    if (attr->value != NULL)
+	strncpy(attr->value, str, attr->value_length);
+    else
+	attr->value_length = 0;
+}
+
 void
 nabi_ic_get_values(NabiIC *ic, IMChangeICStruct *data)
 {
@@ -1120,143 +1128,124 @@ nabi_ic_get_values(NabiIC *ic, IMChangeICStruct *data)
     
     attr = data->ic_attr;
     for (i = 0; i < data->ic_attr_num; i++, attr++) {
-	if (streql(XNFilterEvents, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = KeyPressMask | KeyReleaseMask;
-	} else if (streql(XNInputStyle, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->input_style;
-	} else if (streql(XNPreeditState, attr->name)) {
+	switch (attr->kind) {
+	case XimAttr_FilterEvents:
+	    nabi_ic_attr_set_card32(attr, nabi_filter_mask);
+	    break;
+	case XimAttr_InputStyle:
+	    nabi_ic_attr_set_card32(attr, ic->input_style);
+	    break;
+	case XimAttr_PreeditState:
 	    /* some java applications need XNPreeditState attribute in
 	     * IC attribute instead of Preedit attributes
 	     * so we support XNPreeditState attr here */
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->preedit.state;
-	} else if (streql(XNSeparatorofNestedList, attr->name)) {
+	    nabi_ic_attr_set_card32(attr, ic->preedit.state);
+	    break;
+	case XimAttr_SeparatorofNestedList:
 	    // ignore
-	} else {
+	    break;
+	default:
 	    nabi_log(1, "get unknown ic attributes: %s\n", attr->name);
+	    break;
 	}
-
-	if (attr->value == NULL)
-	    attr->value_length = 0;
     }
     
     attr = data->preedit_attr;
     for (i = 0; i < data->preedit_attr_num; i++, attr++) {
-	if (streql(XNArea, attr->name)) {
-	    attr->value_length = sizeof(XRectangle);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(XRectangle*)attr->value = ic->preedit.area;
-	} else if (streql(XNAreaNeeded, attr->name)) {
-	    attr->value_length = sizeof(XRectangle);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(XRectangle*)attr->value = ic->preedit.area_needed;
-	} else if (streql(XNSpotLocation, attr->name)) {
-	    attr->value_length = sizeof(XPoint);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(XPoint*)attr->value = ic->preedit.spot;
-	} else if (streql(XNForeground, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->preedit.foreground;
-	} else if (streql(XNBackground, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->preedit.background;
-	} else if (streql(XNLineSpace, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->preedit.line_space;
-	} else if (streql(XNPreeditState, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->preedit.state;
-	} else if (streql(XNFontSet, attr->name)) {
-	    attr->value_length = strlen(ic->preedit.base_font) + 1;
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		strncpy(attr->value, ic->preedit.base_font, attr->value_length);
-	} else {
+	switch (attr->kind) {
+	case XimAttr_Area:
+	    nabi_ic_attr_set_rect(attr, &ic->preedit.area);
+	    break;
+	case XimAttr_AreaNeeded:
+	    nabi_ic_attr_set_rect(attr, &ic->preedit.area_needed);
+	    break;
+	case XimAttr_SpotLocation:
+	    nabi_ic_attr_set_point(attr, &ic->preedit.spot);
+	    break;
+	case XimAttr_Foreground:
+	    nabi_ic_attr_set_card32(attr, ic->preedit.foreground);
+	    break;
+	case XimAttr_Background:
+	    nabi_ic_attr_set_card32(attr, ic->preedit.background);
+	    break;
+	case XimAttr_LineSpace:
+	    nabi_ic_attr_set_card32(attr, ic->preedit.line_space);
+	    break;
+	case XimAttr_PreeditState:
+	    nabi_ic_attr_set_card32(attr, ic->preedit.state);
+	    break;
+	case XimAttr_FontSet:
+	    nabi_ic_attr_set_string(attr, ic->preedit.base_font);
+	    break;
+	default:
 	    nabi_log(1, "get unknown preedit attributes: %s\n", attr->name);
+	    break;
 	}
-
-	if (attr->value == NULL)
-	    attr->value_length = 0;
     }
 
     attr = data->status_attr;
     for (i = 0; i < data->status_attr_num; i++, attr++) {
-	if (streql(XNArea, attr->name)) {
-	    attr->value_length = sizeof(XRectangle);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(XRectangle*)attr->value = ic->status.area;
-	} else if (streql(XNAreaNeeded, attr->name)) {
-	    attr->value_length = sizeof(XRectangle);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(XRectangle*)attr->value = ic->status.area_needed;
-	} else if (streql(XNForeground, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->status.foreground;
-	} else if (streql(XNBackground, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->status.background;
-	} else if (streql(XNLineSpace, attr->name)) {
-	    attr->value_length = sizeof(CARD32);
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		*(CARD32*)attr->value = ic->status.line_space;
-	} else if (streql(XNFontSet, attr->name)) {
-	    attr->value_length = strlen(ic->status.base_font) + 1;
-	    attr->value = malloc(attr->value_length);
-	    if (attr->value != NULL)
-		strncpy(attr->value, ic->status.base_font, attr->value_length);
-	} else {
+	switch (attr->kind) {
+	case XimAttr_Area:
+	    nabi_ic_attr_set_rect(attr, &ic->status.area);
+	    break;
+	case XimAttr_AreaNeeded:
+	    nabi_ic_attr_set_rect(attr, &ic->status.area_needed);
+	    break;
+	case XimAttr_Foreground:
+	    nabi_ic_attr_set_card32(attr, ic->status.foreground);
+	    break;
+	case XimAttr_Background:
+	    nabi_ic_attr_set_card32(attr, ic->status.background);
+	    break;
+	case XimAttr_LineSpace:
+	    nabi_ic_attr_set_card32(attr, ic->status.line_space);
+	    break;
+	case XimAttr_FontSet:
+	    nabi_ic_attr_set_string(attr, ic->status.base_font);
+	    break;
+	default:
 	    nabi_log(1, "get unknown status attributes: %s\n", attr->name);
+	    break;
 	}
-
-	if (attr->value == NULL)
-	    attr->value_length = 0;
     }
 }
 
-#undef streql
-
+/* the result is malloc()ed, so that IMdkit can XFree() it */
 static char *utf8_to_compound_text(const char *utf8)
 {
-    char *list[2];
-    XTextProperty tp;
-    int ret;
+    int len;
+    char *ct;
+
+    len = IMUtf8ToCompoundText(utf8, -1, NULL, 0);
+    ct = malloc(len + 1);
+    if (ct != NULL)
+	IMUtf8ToCompoundText(utf8, -1, ct, len + 1);
+    return ct;
+}
+
+/* returns the text in the encoding negotiated on the connection, which is
+ * the utf8 string itself for UTF8_STRING clients, or COMPOUND_TEXT in buf
+ * if it fits there. So free it with nabi_ic_free_text() */
+static char *
+nabi_ic_encode_text(NabiIC *ic, const char *utf8, char *buf, int size)
+{
+    int len;
 
-    list[0] = g_locale_from_utf8(utf8, -1, NULL, NULL, NULL);
-    list[1] = 0;
-    ret = XmbTextListToTextProperty(nabi_server->display, list, 1,
-				    XCompoundTextStyle,
-				    &tp);
-    g_free(list[0]);
+    if (ic->connection->utf8)
+	return (char*)utf8;
 
-    if (ret > 0)
-	nabi_log(1, "conversion failure: %d\n", ret);
-    return (char*)tp.value;
+    len = IMUtf8ToCompoundText(utf8, -1, buf, size);
+    if (len < size)
+	return buf;
+    return utf8_to_compound_text(utf8);
+}
+
+static void
+nabi_ic_free_text(const char *utf8, const char *buf, char *text)
+{
+    if (text != utf8 && text != buf)
+	free(text);
 }
 
 void
@@ -1264,9 +1253,14 @@ nabi_ic_reset(NabiIC *ic, IMResetICStruct *data)
 {
     char* preedit = nabi_ic_get_flush_string(ic);
     if (preedit != NULL && strlen(preedit) > 0) {
-	char* compound_text = utf8_to_compound_text(preedit);
-	data->commit_string = compound_text;
-	data->length = strlen(compound_text);
+	/* IMdkit frees the commit string with XFree */
+	char* text;
+	if (ic->connection->utf8)
+	    text = strdup(preedit);
+	else
+	    text = utf8_to_compound_text(preedit);
+	data->commit_string = text;
+	data->length = strlen(text);
     } else {
 	data->commit_string = NULL;
 	data->length = 0;
@@ -1275,6 +1269,8 @@ nabi_ic_reset(NabiIC *ic, IMResetICStruct *data)
 
     ustring_clear(ic->preedit.str);
     ic->preedit.prev_length = 0;
+    ustring_clear(ic->preedit.drawn);
+    g_array_set_size(ic->preedit.drawn_feedback, 0);
 
     if (ic->input_style & XIMPreeditPosition) {
 	nabi_ic_preedit_hide(ic);
@@ -1290,9 +1286,9 @@ nabi_ic_set_focus(NabiIC* ic)
 {
     NabiInputMode mode = ic->mode;
 
-    switch (nabi_server->input_mode_scope) {
+    switch (ic->server->input_mode_scope) {
     case NABI_INPUT_MODE_PER_DESKTOP:
-	mode = nabi_server->input_mode;
+	mode = ic->server->input_mode;
 	break;
     case NABI_INPUT_MODE_PER_APPLICATION:
 	if (ic->connection != NULL)
@@ -1308,15 +1304,15 @@ nabi_ic_set_focus(NabiIC* ic)
     }
 
     nabi_ic_set_mode(ic, mode);
-    nabi_ic_set_hangul_keyboard(ic, nabi_server->hangul_keyboard);
+    nabi_ic_set_hangul_keyboard(ic, ic->server->hangul_keyboard);
 }
 
 void
 nabi_ic_set_mode(NabiIC *ic, NabiInputMode mode)
 {
-    switch (nabi_server->input_mode_scope) {
+    switch (ic->server->input_mode_scope) {
     case NABI_INPUT_MODE_PER_DESKTOP:
-	nabi_server->input_mode = mode;
+	ic->server->input_mode = mode;
 	break;
     case NABI_INPUT_MODE_PER_APPLICATION:
 	if (ic->connection != NULL)
@@ -1336,7 +1332,7 @@ nabi_ic_set_mode(NabiIC *ic, NabiInputMode mode)
     switch (mode) {
     case NABI_INPUT_MODE_DIRECT:
 	nabi_ic_flush(ic);
-	nabi_server_set_mode_info(nabi_server, NABI_MODE_INFO_DIRECT);
+	nabi_server_set_mode_info(ic->server, NABI_MODE_INFO_DIRECT);
 	nabi_ic_end_composing(ic);
 	break;
     case NABI_INPUT_MODE_COMPOSE:
@@ -1358,7 +1354,8 @@ nabi_ic_set_mode(NabiIC *ic, NabiInputMode mode)
 	 * 이 문제를 쉽게 해결하기 위해서 preedit start 프로토콜을
 	 * 아무 키입력이나 시작했을 때에 보내는 방식으로 바꾼다.
 	 */
-	nabi_server_set_mode_info(nabi_server, NABI_MODE_INFO_COMPOSE);
+	nabi_ic_get_hic(ic);
+	nabi_server_set_mode_info(ic->server, NABI_MODE_INFO_COMPOSE);
 	nabi_ic_start_composing(ic);
 	break;
     default:
@@ -1378,12 +1375,12 @@ nabi_ic_start_composing(NabiIC *ic)
 
     ic->composing_started = TRUE;
 
-    if (nabi_server->dynamic_event_flow) {
+    if (ic->server->dynamic_event_flow) {
 	IMPreeditStateStruct preedit_state;
 
 	preedit_state.connect_id = ic->connection->id;
 	preedit_state.icid = ic->id;
-	IMPreeditStart(nabi_server->xims, (XPointer)&preedit_state);
+	IMPreeditStart(ic->server->xims, (XPointer)&preedit_state);
     }
 }
 
@@ -1397,12 +1394,12 @@ nabi_ic_end_composing(NabiIC *ic)
 
     ic->composing_started = FALSE;
 
-    if (nabi_server->dynamic_event_flow) {
+    if (ic->server->dynamic_event_flow) {
 	IMPreeditStateStruct preedit_state;
 
 	preedit_state.connect_id = ic->connection->id;
 	preedit_state.icid = ic->id;
-	IMPreeditEnd(nabi_server->xims, (XPointer)&preedit_state);
+	IMPreeditEnd(ic->server->xims, (XPointer)&preedit_state);
     }
 }
 
@@ -1423,7 +1420,7 @@ nabi_ic_preedit_start(NabiIC *ic)
 	    preedit_data.connect_id = ic->connection->id;
 	    preedit_data.icid = ic->id;
 	    preedit_data.todo.return_value = 0;
-	    IMCallCallback(nabi_server->xims, (XPointer)&preedit_data);
+	    IMCallCallback(ic->server->xims, (XPointer)&preedit_data);
 	}
     } else if (ic->input_style & XIMPreeditPosition) {
 	if (ic->preedit.window == NULL)
@@ -1455,7 +1452,7 @@ nabi_ic_preedit_done(NabiIC *ic)
 	    preedit_data.connect_id = ic->connection->id;
 	    preedit_data.icid = ic->id;
 	    preedit_data.todo.return_value = 0;
-	    IMCallCallback(nabi_server->xims, (XPointer)&preedit_data);
+	    IMCallCallback(ic->server->xims, (XPointer)&preedit_data);
 	}
     } else if (ic->input_style & XIMPreeditPosition) {
 	nabi_ic_preedit_hide(ic);
@@ -1468,10 +1465,21 @@ nabi_ic_preedit_done(NabiIC *ic)
     ic->preedit.start = False;
 }
 
+/* an ic without a hic has never composed anything */
+static const ucschar nabi_ic_empty_ucs[] = { 0 };
+
+static const ucschar*
+nabi_ic_hic_preedit(NabiIC *ic)
+{
+    if (ic->hic == NULL)
+	return nabi_ic_empty_ucs;
+    return hangul_ic_get_preedit_string(ic->hic);
+}
+
 static char*
 nabi_ic_get_hic_preedit_string(NabiIC *ic)
 {
-    const ucschar *str = hangul_ic_get_preedit_string(ic->hic);
+    const ucschar *str = nabi_ic_hic_preedit(ic);
     return g_ucs4_to_utf8((const gunichar*)str, -1, NULL, NULL, NULL);
 }
 
@@ -1485,7 +1493,7 @@ nabi_ic_get_preedit_string(NabiIC *ic)
     str = ustring_new();
     ustring_append(str, ic->preedit.str);
 
-    hic_preedit = hangul_ic_get_preedit_string(ic->hic);
+    hic_preedit = nabi_ic_hic_preedit(ic);
     ustring_append_ucs4(str, hic_preedit, -1);
 
     preedit = ustring_to_utf8(str, str->len);
@@ -1497,7 +1505,12 @@ nabi_ic_get_preedit_string(NabiIC *ic)
 static char*
 nabi_ic_get_hic_commit_string(NabiIC *ic)
 {
-    const ucschar *str = hangul_ic_get_commit_string(ic->hic);
+    const ucschar *str;
+
+    if (ic->hic == NULL)
+	return NULL;
+
+    str = hangul_ic_get_commit_string(ic->hic);
     return g_ucs4_to_utf8((const gunichar*)str, -1, NULL, NULL, NULL);
 }
 
@@ -1511,7 +1524,10 @@ nabi_ic_get_flush_string(NabiIC *ic)
     str = ustring_new();
     ustring_append(str, ic->preedit.str);
 
-    hic_flushed = hangul_ic_flush(ic->hic);
+    if (ic->hic != NULL)
+	hic_flushed = hangul_ic_flush(ic->hic);
+    else
+	hic_flushed = nabi_ic_empty_ucs;
     ustring_append_ucs4(str, hic_flushed, -1);
 
     flushed = ustring_to_utf8(str, -1);
@@ -1520,23 +1536,84 @@ nabi_ic_get_flush_string(NabiIC *ic)
     return flushed;
 }
 
-static inline XIMFeedback *
-nabi_ic_preedit_feedback_new(int underline_len, int reverse_len)
+static inline XIMFeedback
+nabi_ic_preedit_feedback(int index, int underline_len)
 {
-    int i, len = underline_len + reverse_len;
-    XIMFeedback *feedback = g_new(XIMFeedback, len + 1);
+    return index < underline_len ? XIMUnderline : XIMReverse;
+}
 
-    if (feedback != NULL) {
-	for (i = 0; i < underline_len; ++i)
-	    feedback[i] = XIMUnderline;
+/* Sends the client only the span of the preedit string which differs
+ * from what it has got, so that on a long preedit, such as a word in
+ * commit_by_word mode, a keystroke does not redraw the whole string. */
+static void
+nabi_ic_preedit_draw_changes(NabiIC *ic, const UString *str, int normal_len)
+{
+    UString* drawn = ic->preedit.drawn;
+    GArray* drawn_feedback = ic->preedit.drawn_feedback;
+    const ucschar* s = (const ucschar*)str->data;
+    int len = ustring_length(str);
+    int drawn_len = ustring_length(drawn);
+    guint first, last;
+    int chg_len, i;
+    char buf[256];
+    char* utf8;
+    char* encoded;
+    XIMFeedback feedback_buf[64];
+    XIMFeedback* feedback;
+    XIMText text;
+    IMPreeditCBStruct data;
+
+    if (len < (int)G_N_ELEMENTS(feedback_buf))
+	feedback = feedback_buf;
+    else
+	feedback = g_new(XIMFeedback, len + 1);
+    for (i = 0; i < len; i++)
+	feedback[i] = nabi_ic_preedit_feedback(i, normal_len);
+
+    ustring_diff(str, feedback, drawn, drawn_feedback->data,
+		 sizeof(XIMFeedback), &first, &last);
+    if (first == len && first == drawn_len) {
+	if (feedback != feedback_buf)
+	    g_free(feedback);
+	return;
+    }
 
-	for (i = underline_len; i < len; ++i)
-	    feedback[i] = XIMReverse;
+    chg_len = len - first - last;
 
-	feedback[len] = 0;
-    }
+    /* the client has the new string from now on */
+    g_array_set_size(drawn_feedback, len);
+    memcpy(drawn_feedback->data, feedback, len * sizeof(XIMFeedback));
+    feedback[first + chg_len] = 0;
+
+    utf8 = g_ucs4_to_utf8((const gunichar*)s + first, chg_len,
+			  NULL, NULL, NULL);
+    encoded = nabi_ic_encode_text(ic, utf8, buf, sizeof(buf));
+
+    nabi_log(3, "draw preedit: id = %d-%d, %d + %d -> '%s'\n",
+	     ic->connection->id, ic->id, first, drawn_len - first - last, utf8);
+
+    data.major_code = XIM_PREEDIT_DRAW;
+    data.minor_code = 0;
+    data.connect_id = ic->connection->id;
+    data.icid = ic->id;
+    data.todo.draw.caret = len;
+    data.todo.draw.chg_first = first;
+    data.todo.draw.chg_length = drawn_len - first - last;
+    data.todo.draw.text = &text;
+
+    text.feedback = feedback + first;
+    text.encoding_is_wchar = False;
+    text.string.multi_byte = chg_len > 0 ? encoded : NULL;
+    text.length = chg_len > 0 ? strlen(encoded) : 0;
+
+    IMCallCallback(ic->server->xims, (XPointer)&data);
+    nabi_ic_free_text(utf8, buf, encoded);
+    g_free(utf8);
+    if (feedback != feedback_buf)
+	g_free(feedback);
 
-    return feedback;
+    ustring_clear(drawn);
+    ustring_append(drawn, str);
 }
 
 void
@@ -1556,10 +1633,8 @@ nabi_ic_preedit_update(NabiIC *ic)
     preedit_len = normal_len + hilight_len;
 
     if (preedit_len <= 0) {
-	if (ic->candidate != NULL) {
-	    nabi_candidate_delete(ic->candidate);
-	    ic->candidate = NULL;
-	}
+	if (ic->has_candidate)
+	    nabi_ic_close_candidate_window(ic);
 
 	nabi_ic_preedit_clear(ic);
 	g_free(normal);
@@ -1580,43 +1655,26 @@ nabi_ic_preedit_update(NabiIC *ic)
 
     if (ic->input_style & XIMPreeditCallbacks) {
 	if (ic->preedit.has_draw_cb) {
-	    char *compound_text;
-	    XIMText text;
-	    IMPreeditCBStruct data;
-
-	    compound_text = utf8_to_compound_text(preedit);
-
-	    data.major_code = XIM_PREEDIT_DRAW;
-	    data.minor_code = 0;
-	    data.connect_id = ic->connection->id;
-	    data.icid = ic->id;
-	    data.todo.draw.caret = preedit_len;
-	    data.todo.draw.chg_first = 0;
-	    data.todo.draw.chg_length = ic->preedit.prev_length;
-	    data.todo.draw.text = &text;
+	    UString* str = ustring_new();
 
-	    text.feedback = nabi_ic_preedit_feedback_new(normal_len, hilight_len);
-	    text.encoding_is_wchar = False;
-	    text.string.multi_byte = compound_text;
-	    text.length = strlen(compound_text);
-
-	    IMCallCallback(nabi_server->xims, (XPointer)&data);
-	    g_free(text.feedback);
-	    XFree(compound_text);
+	    ustring_append(str, ic->preedit.str);
+	    ustring_append_ucs4(str, nabi_ic_hic_preedit(ic), -1);
+	    nabi_ic_preedit_draw_changes(ic, str, normal_len);
+	    ustring_delete(str);
 	}
     } else if (ic->input_style & XIMPreeditPosition) {
 	nabi_ic_preedit_show(ic);
-	if (!nabi_server->ignore_app_fontset &&
+	if (!ic->server->ignore_app_fontset &&
 	    ic->preedit.font_set != NULL)
 	    nabi_ic_preedit_x11_draw_string(ic, preedit, normal, hilight);
 	else
-	    nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	    nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     } else if (ic->input_style & XIMPreeditArea) {
 	nabi_ic_preedit_show(ic);
-	nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     } else if (ic->input_style & XIMPreeditNothing) {
 	nabi_ic_preedit_show(ic);
-	nabi_ic_preedit_gdk_draw_string(ic, preedit, normal, hilight);
+	nabi_ic_preedit_draw_string(ic, preedit, normal, hilight);
     }
     ic->preedit.prev_length = preedit_len;
 
@@ -1654,7 +1712,7 @@ nabi_ic_preedit_clear(NabiIC *ic)
 	    text.string.multi_byte = NULL;
 	    text.length = 0;
 
-	    IMCallCallback(nabi_server->xims, (XPointer)&data);
+	    IMCallCallback(ic->server->xims, (XPointer)&data);
 	}
     } else if (ic->input_style & XIMPreeditPosition) {
 	nabi_ic_preedit_hide(ic);
@@ -1664,13 +1722,16 @@ nabi_ic_preedit_clear(NabiIC *ic)
 	nabi_ic_preedit_hide(ic);
     }
     ic->preedit.prev_length = 0;
+    ustring_clear(ic->preedit.drawn);
+    g_array_set_size(ic->preedit.drawn_feedback, 0);
 }
 
 static void
 nabi_ic_commit_utf8(NabiIC *ic, const char *utf8_str)
 {
     IMCommitStruct commit_data;
-    char *compound_text;
+    char buf[256];
+    char *encoded;
 
     /* According to XIM Spec, We should delete preedit string here 
      * befor commiting the string. but it makes too many flickering
@@ -1684,17 +1745,18 @@ nabi_ic_commit_utf8(NabiIC *ic, const char *utf8_str)
 
     nabi_log(1, "commit: id = %d-%d, str = '%s'\n",
 	     ic->connection->id, ic->id, utf8_str);
-    compound_text = utf8_to_compound_text(utf8_str);
+    ic->server->statistics.commit += g_utf8_strlen(utf8_str, -1);
+    encoded = nabi_ic_encode_text(ic, utf8_str, buf, sizeof(buf));
 
     commit_data.major_code = XIM_COMMIT;
     commit_data.minor_code = 0;
     commit_data.connect_id = ic->connection->id;
     commit_data.icid = ic->id;
     commit_data.flag = XimLookupChars;
-    commit_data.commit_string = compound_text;
+    commit_data.commit_string = encoded;
 
-    IMCommitString(nabi_server->xims, (XPointer)&commit_data);
-    XFree(compound_text);
+    IMCommitString(ic->server->xims, (XPointer)&commit_data);
+    nabi_ic_free_text(utf8_str, buf, encoded);
 
     /* we delete preedit string here when PreeditPosition */
     if (!(ic->input_style & XIMPreeditCallbacks))
@@ -1704,8 +1766,8 @@ nabi_ic_commit_utf8(NabiIC *ic, const char *utf8_str)
 Bool
 nabi_ic_commit(NabiIC *ic)
 {
-    if (nabi_server->commit_by_word ||
-	nabi_server->hanja_mode) {
+    if (ic->server->commit_by_word ||
+	ic->server->hanja_mode) {
 	const ucschar *str = hangul_ic_get_commit_string(ic->hic);
 
 	ustring_append_ucs4(ic->preedit.str, str, -1);
@@ -1741,7 +1803,7 @@ nabi_ic_flush(NabiIC *ic)
 void
 nabi_ic_status_start(NabiIC *ic)
 {
-    if (!nabi_server->show_status)
+    if (!ic->server->show_status)
 	return;
 
     if (ic->input_style & XIMStatusCallbacks) {
@@ -1764,7 +1826,7 @@ nabi_ic_status_start(NabiIC *ic)
 	text.string.multi_byte = compound_text;
 	text.length = strlen(compound_text);
 
-	IMCallCallback(nabi_server->xims, (XPointer)&data);
+	IMCallCallback(ic->server->xims, (XPointer)&data);
     }
     g_print("Status start\n");
 }
@@ -1772,7 +1834,7 @@ nabi_ic_status_start(NabiIC *ic)
 void
 nabi_ic_status_done(NabiIC *ic)
 {
-    if (!nabi_server->show_status)
+    if (!ic->server->show_status)
 	return;
 
     if (ic->input_style & XIMStatusCallbacks) {
@@ -1795,7 +1857,7 @@ nabi_ic_status_done(NabiIC *ic)
 	text.string.multi_byte = compound_text;
 	text.length = strlen(compound_text);
 
-	IMCallCallback(nabi_server->xims, (XPointer)&data);
+	IMCallCallback(ic->server->xims, (XPointer)&data);
     }
     g_print("Status done\n");
 }
@@ -1803,13 +1865,14 @@ nabi_ic_status_done(NabiIC *ic)
 void
 nabi_ic_status_update(NabiIC *ic)
 {
-    if (!nabi_server->show_status)
+    if (!ic->server->show_status)
 	return;
 
     if (ic->input_style & XIMStatusCallbacks) {
 	IMStatusCBStruct data;
 	char *status_str;
-	char *compound_text;
+	char buf[64];
+	char *encoded;
 	XIMText text;
 	XIMFeedback feedback[4] = { 0, 0, 0, 0 };
 
@@ -1824,7 +1887,7 @@ nabi_ic_status_update(NabiIC *ic)
 	    status_str = "";
 	    break;
 	}
-	compound_text = utf8_to_compound_text(status_str);
+	encoded = nabi_ic_encode_text(ic, status_str, buf, sizeof(buf));
 
 	data.major_code = XIM_STATUS_DRAW;
 	data.minor_code = 0;
@@ -1835,43 +1898,101 @@ nabi_ic_status_update(NabiIC *ic)
 
 	text.feedback = feedback;
 	text.encoding_is_wchar = False;
-	text.string.multi_byte = compound_text;
-	text.length = strlen(compound_text);
+	text.string.multi_byte = encoded;
+	text.length = strlen(encoded);
 
-	IMCallCallback(nabi_server->xims, (XPointer)&data);
+	IMCallCallback(ic->server->xims, (XPointer)&data);
+	nabi_ic_free_text(status_str, buf, encoded);
     }
     g_print("Status draw\n");
 }
 
+#ifndef NABI_XIM_ONLY
+/* The candidate windows belong to the ui. The ic only asks for them
+ * with nabi_server_call_ui(), and the hanja the user picks comes back
+ * with nabi_server_call_xim(), so with --xim-thread a busy ui never
+ * holds up the protocol. */
+enum {
+    NABI_CANDIDATE_SHOW,
+    NABI_CANDIDATE_KEY,
+    NABI_CANDIDATE_CLOSE
+};
+
+typedef struct {
+    int           request;
+    NabiICHandle  handle;
+    char*         label;
+    HanjaList*    list;
+    const Hanja** valid_list;
+    int           valid_list_length;
+    Window        parent;
+    KeySym        keyval;
+    Bool          hanja_mode;
+    PangoFontDescription* font;
+    Bool          use_simplified_chinese;
+} NabiCandidateRequest;
+
+typedef struct {
+    NabiICHandle  handle;
+    char*         key;
+    char*         value;
+} NabiCandidateChoice;
+
+/* NabiICHandle -> NabiCandidate, only the ui touches it */
+static GHashTable* nabi_ic_candidates = NULL;
+
+static guint
+nabi_ic_handle_hash(gconstpointer key)
+{
+    const NabiICHandle* handle = (const NabiICHandle*)key;
+
+    return (handle->connect_id << 16) ^ handle->id ^ handle->generation;
+}
+
+static gboolean
+nabi_ic_handle_equal(gconstpointer a, gconstpointer b)
+{
+    const NabiICHandle* h1 = (const NabiICHandle*)a;
+    const NabiICHandle* h2 = (const NabiICHandle*)b;
+
+    return h1->connect_id == h2->connect_id &&
+	   h1->id == h2->id &&
+	   h1->generation == h2->generation;
+}
+
+/* Moves or picks in the candidate window by the key. Without a
+ * candidate nothing happens, it only tells whether the key belongs to
+ * the window and whether it closes it. */
 static Bool
-nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
+nabi_ic_candidate_key(NabiCandidate* candidate, KeySym keyval,
+		      Bool hanja_mode, Bool* close)
 {
     const Hanja* hanja = NULL;
 
+    *close = False;
     switch (keyval) {
     case XK_Up:
-	nabi_candidate_prev(ic->candidate);
+	nabi_candidate_prev(candidate);
 	break;
     case XK_Down:
-	nabi_candidate_next(ic->candidate);
+	nabi_candidate_next(candidate);
 	break;
     case XK_Left:
     case XK_Page_Up:
     case XK_KP_Subtract:
-	nabi_candidate_prev_page(ic->candidate);
+	nabi_candidate_prev_page(candidate);
 	break;
     case XK_Right:
     case XK_Page_Down:
     case XK_KP_Add:
-	nabi_candidate_next_page(ic->candidate);
+	nabi_candidate_next_page(candidate);
 	break;
     case XK_Escape:
-	nabi_candidate_delete(ic->candidate);
-	ic->candidate = NULL;
+	*close = True;
 	break;
     case XK_Return:
     case XK_KP_Enter:
-	hanja = nabi_candidate_get_current(ic->candidate);
+	hanja = nabi_candidate_get_current(candidate);
 	break;
     case XK_1:
     case XK_2:
@@ -1882,7 +2003,7 @@ nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
     case XK_7:
     case XK_8:
     case XK_9:
-	hanja = nabi_candidate_get_nth(ic->candidate, keyval - XK_1);
+	hanja = nabi_candidate_get_nth(candidate, keyval - XK_1);
 	break;
     case XK_KP_1:
     case XK_KP_2:
@@ -1893,53 +2014,53 @@ nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
     case XK_KP_7:
     case XK_KP_8:
     case XK_KP_9:
-	hanja = nabi_candidate_get_nth(ic->candidate, keyval - XK_KP_1);
+	hanja = nabi_candidate_get_nth(candidate, keyval - XK_KP_1);
 	break;
     case XK_KP_End:
-	hanja = nabi_candidate_get_nth(ic->candidate, 0);
+	hanja = nabi_candidate_get_nth(candidate, 0);
 	break;
     case XK_KP_Down:
-	hanja = nabi_candidate_get_nth(ic->candidate, 1);
+	hanja = nabi_candidate_get_nth(candidate, 1);
 	break;
     case XK_KP_Next:
-	hanja = nabi_candidate_get_nth(ic->candidate, 2);
+	hanja = nabi_candidate_get_nth(candidate, 2);
 	break;
     case XK_KP_Left:
-	hanja = nabi_candidate_get_nth(ic->candidate, 3);
+	hanja = nabi_candidate_get_nth(candidate, 3);
 	break;
     case XK_KP_Begin:
-	hanja = nabi_candidate_get_nth(ic->candidate, 4);
+	hanja = nabi_candidate_get_nth(candidate, 4);
 	break;
     case XK_KP_Right:
-	hanja = nabi_candidate_get_nth(ic->candidate, 5);
+	hanja = nabi_candidate_get_nth(candidate, 5);
 	break;
     case XK_KP_Home:
-	hanja = nabi_candidate_get_nth(ic->candidate, 6);
+	hanja = nabi_candidate_get_nth(candidate, 6);
 	break;
     case XK_KP_Up:
-	hanja = nabi_candidate_get_nth(ic->candidate, 7);
+	hanja = nabi_candidate_get_nth(candidate, 7);
 	break;
     case XK_KP_Prior:
-	hanja = nabi_candidate_get_nth(ic->candidate, 8);
+	hanja = nabi_candidate_get_nth(candidate, 8);
 	break;
     default:
-	if (nabi_server->hanja_mode) {
+	if (hanja_mode) {
 	    return False;
 	} else {
 	    switch (keyval) {
 	    case XK_k:
-		nabi_candidate_prev(ic->candidate);
+		nabi_candidate_prev(candidate);
 		break;
 	    case XK_j:
-		nabi_candidate_next(ic->candidate);
+		nabi_candidate_next(candidate);
 		break;
 	    case XK_h:
-		nabi_candidate_prev_page(ic->candidate);
+		nabi_candidate_prev_page(candidate);
 		break;
 	    case XK_l:
 	    case XK_space:
 	    case XK_Tab:
-		nabi_candidate_next_page(ic->candidate);
+		nabi_candidate_next_page(candidate);
 		break;
 	    default:
 		return False;
@@ -1947,12 +2068,157 @@ nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
 	}
     }
 
-    if (hanja != NULL) {
-	nabi_ic_insert_candidate(ic, hanja);
+    if (hanja != NULL && candidate->commit != NULL)
+	candidate->commit(candidate, hanja, candidate->commit_data);
+
+    return True;
+}
+
+static NabiCandidateRequest*
+nabi_ic_candidate_request_new(NabiIC* ic, int type)
+{
+    NabiCandidateRequest* request = g_new0(NabiCandidateRequest, 1);
+
+    request->request = type;
+    nabi_ic_get_handle(ic, &request->handle);
+    return request;
+}
+
+/* the lists are left only when no candidate window took them */
+static void
+nabi_ic_candidate_request_free(gpointer data)
+{
+    NabiCandidateRequest* request = (NabiCandidateRequest*)data;
+
+    if (request->list != NULL)
+	hanja_list_delete(request->list);
+    g_free(request->valid_list);
+    g_free(request->label);
+    if (request->font != NULL)
+	pango_font_description_free(request->font);
+    g_free(request);
+}
+
+static void
+nabi_ic_candidate_choice_free(gpointer data)
+{
+    NabiCandidateChoice* choice = (NabiCandidateChoice*)data;
+
+    g_free(choice->key);
+    g_free(choice->value);
+    g_free(choice);
+}
+
+/* on the xim side */
+static void
+nabi_ic_candidate_choice_cb(gpointer data)
+{
+    NabiCandidateChoice* choice = (NabiCandidateChoice*)data;
+    NabiIC* ic;
+
+    ic = nabi_server_get_ic_by_handle(choice->handle.server, &choice->handle);
+    if (ic != NULL) {
+	nabi_ic_insert_candidate(ic, choice->key, choice->value);
 	nabi_ic_preedit_update(ic);
 	nabi_ic_update_candidate_window(ic);
     }
 
+    nabi_ic_candidate_choice_free(choice);
+}
+
+/* on the ui side */
+static void
+nabi_ic_candidate_commit_cb(NabiCandidate *candidate,
+			    const Hanja* hanja, gpointer data)
+{
+    NabiCandidateChoice* choice;
+
+    if (candidate == NULL || data == NULL)
+	return;
+
+    choice = g_new(NabiCandidateChoice, 1);
+    choice->handle = *(NabiICHandle*)data;
+    choice->key = g_strdup(hanja_get_key(hanja));
+    choice->value = g_strdup(hanja_get_value(hanja));
+    nabi_server_call_xim(choice->handle.server,
+			 nabi_ic_candidate_choice_cb, choice,
+			 nabi_ic_candidate_choice_free);
+}
+
+/* on the ui side */
+static void
+nabi_ic_candidate_request_cb(gpointer data)
+{
+    NabiCandidateRequest* request = (NabiCandidateRequest*)data;
+    NabiCandidate* candidate;
+    NabiICHandle* handle;
+    Bool close;
+
+    GDK_THREADS_ENTER();
+
+    if (nabi_ic_candidates == NULL)
+	nabi_ic_candidates = g_hash_table_new_full(nabi_ic_handle_hash,
+				nabi_ic_handle_equal,
+				g_free, (GDestroyNotify)nabi_candidate_delete);
+
+    candidate = g_hash_table_lookup(nabi_ic_candidates, &request->handle);
+    switch (request->request) {
+    case NABI_CANDIDATE_SHOW:
+	if (candidate != NULL) {
+	    nabi_candidate_set_hanja_list(candidate, request->list,
+			    request->valid_list, request->valid_list_length);
+	} else {
+	    /* the window refers to the ic by handle, the table owns it */
+	    handle = g_new(NabiICHandle, 1);
+	    *handle = request->handle;
+	    candidate = nabi_candidate_new(request->handle.server,
+			    request->label, 9, request->list,
+			    request->valid_list, request->valid_list_length,
+			    request->parent, request->font,
+			    request->use_simplified_chinese,
+			    &nabi_ic_candidate_commit_cb, handle);
+	    g_hash_table_insert(nabi_ic_candidates, handle, candidate);
+	}
+	/* the candidate window owns the lists now */
+	request->list = NULL;
+	request->valid_list = NULL;
+	break;
+    case NABI_CANDIDATE_KEY:
+	if (candidate != NULL)
+	    nabi_ic_candidate_key(candidate, request->keyval,
+				  request->hanja_mode, &close);
+	break;
+    case NABI_CANDIDATE_CLOSE:
+	g_hash_table_remove(nabi_ic_candidates, &request->handle);
+	break;
+    default:
+	break;
+    }
+
+    GDK_THREADS_LEAVE();
+
+    nabi_ic_candidate_request_free(request);
+}
+
+static Bool
+nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
+{
+    NabiCandidateRequest* request;
+    Bool close;
+
+    if (!nabi_ic_candidate_key(NULL, keyval, ic->server->hanja_mode, &close))
+	return False;
+
+    if (close) {
+	nabi_ic_close_candidate_window(ic);
+    } else {
+	request = nabi_ic_candidate_request_new(ic, NABI_CANDIDATE_KEY);
+	request->keyval = keyval;
+	request->hanja_mode = ic->server->hanja_mode;
+	nabi_server_call_ui(ic->server, nabi_ic_candidate_request_cb, request,
+			    nabi_ic_candidate_request_free);
+    }
+
     return True;
 }
 
@@ -1973,11 +2239,19 @@ nabi_ic_request_client_text(NabiIC* ic)
 	data.strconv.factor    = 10;
 	data.strconv.text      = NULL;
 
-	IMCallCallback(nabi_server->xims, (XPointer)&data);
+	IMCallCallback(ic->server->xims, (XPointer)&data);
 	nabi_log(3, "request client text: id = %d-%d\n",
 		    ic->connection->id, ic->id);
     }
 }
+#else
+/* nabi-xim has no candidate window, the candidate keys go to the client */
+static Bool
+nabi_ic_candidate_process(NabiIC* ic, KeySym keyval)
+{
+    return False;
+}
+#endif
 
 static void
 nabi_ic_delete_client_text(NabiIC* ic, size_t len)
@@ -1994,7 +2268,7 @@ nabi_ic_delete_client_text(NabiIC* ic, size_t len)
 	data.strconv.factor    = len;
 	data.strconv.text      = NULL;
 
-	IMCallCallback(nabi_server->xims, (XPointer)&data);
+	IMCallCallback(ic->server->xims, (XPointer)&data);
 	nabi_log(3, "delete client text: id = %d-%d, pos = %d, len = %d\n",
 		    ic->connection->id, ic->id,
 		    data.strconv.position, data.strconv.factor);
@@ -2014,8 +2288,8 @@ nabi_ic_normalize_keysym(NabiIC* ic, KeySym keysym, unsigned int state)
     need_normalize = !hangul_ic_is_transliteration(ic->hic);
     if (need_normalize) {
 	/* for non-qwerty mapping */
-	if (nabi_server->use_system_keymap && nabi_server->layout != NULL) {
-	    keysym = nabi_keyboard_layout_get_key(nabi_server->layout, keysym);
+	if (ic->server->use_system_keymap && ic->server->layout != NULL) {
+	    keysym = nabi_keyboard_layout_get_key(ic->server->layout, keysym);
 	}
 
 	upper = keysym;
@@ -2036,9 +2310,9 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
 {
     Bool ret;
 
-    if (ic->candidate) {
+    if (ic->has_candidate) {
 	ret = nabi_ic_candidate_process(ic, keysym);
-	if (nabi_server->hanja_mode) {
+	if (ic->server->hanja_mode) {
 	    if (ret)
 		return ret;
 	} else {
@@ -2052,7 +2326,7 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
 	return False;
 
     /* for vi user: on Esc we change state to direct mode */
-    if (nabi_server_is_off_key(nabi_server, keysym, state)) {
+    if (nabi_server_is_off_key(ic->server, keysym, state)) {
 	/* 이 경우는 vi 나 emacs등 에디터에서 사용하기 위한 키이므로
 	 * 이 키를 xim에서 사용하지 않고 그대로 다시 forwarding하는 
 	 * 방식으로 작동하게 한다. */
@@ -2061,10 +2335,14 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
     }
 
     /* candiate */
-    if (nabi_server_is_candidate_key(nabi_server, keysym, state)) {
+    if (nabi_server_is_candidate_key(ic->server, keysym, state)) {
+#ifdef NABI_XIM_ONLY
+	return False;
+#else
 	nabi_ic_request_client_text(ic);
 	nabi_ic_update_candidate_window(ic);
 	return True;
+#endif
     }
 
     /* forward key event and commit current string if any state is on */
@@ -2080,7 +2358,9 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
     }
 
     /* save key event log */
-    nabi_server_log_key(nabi_server, keysym, state);
+    nabi_server_log_key(ic->server, keysym, state);
+
+    nabi_ic_get_hic(ic);
 
     if (keysym == XK_BackSpace) {
 	ret = hangul_ic_backspace(ic->hic);
@@ -2108,7 +2388,7 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
 	    nabi_ic_commit_utf8(ic, str);
 	nabi_ic_preedit_update(ic);
 
-	if (nabi_server->hanja_mode) {
+	if (ic->server->hanja_mode) {
 	    nabi_ic_update_candidate_window(ic);
 	}
 	return true;
@@ -2119,44 +2399,35 @@ nabi_ic_process_keyevent(NabiIC* ic, KeySym keysym, unsigned int state)
 	nabi_ic_commit(ic);
 	nabi_ic_preedit_update(ic);
 
-	if (nabi_server->hanja_mode) {
+	if (ic->server->hanja_mode) {
 	    nabi_ic_update_candidate_window(ic);
 	}
 
 	return ret;
     }
 
-    if (nabi_server->hanja_mode) {
-	if (ic->candidate != NULL) {
-	    nabi_candidate_delete(ic->candidate);
-	    ic->candidate = NULL;
-	}
+    if (ic->server->hanja_mode) {
+	if (ic->has_candidate)
+	    nabi_ic_close_candidate_window(ic);
     }
 
     nabi_ic_flush(ic);
     return False;
 }
 
-static void
-nabi_ic_candidate_commit_cb(NabiCandidate *candidate,
-			    const Hanja* hanja, gpointer data)
+#ifndef NABI_XIM_ONLY
+void
+nabi_ic_close_candidate_window(NabiIC* ic)
 {
-    NabiIC *ic;
+    NabiCandidateRequest* request;
 
-    if (candidate == NULL || data == NULL)
+    if (!ic->has_candidate)
 	return;
 
-    ic = (NabiIC*)data;
-    nabi_ic_insert_candidate(ic, hanja);
-    nabi_ic_preedit_update(ic);
-    nabi_ic_update_candidate_window(ic);
-}
-
-static void
-nabi_ic_close_candidate_window(NabiIC* ic)
-{
-    nabi_candidate_delete(ic->candidate);
-    ic->candidate = NULL;
+    request = nabi_ic_candidate_request_new(ic, NABI_CANDIDATE_CLOSE);
+    ic->has_candidate = False;
+    nabi_server_call_ui(ic->server, nabi_ic_candidate_request_cb, request,
+			nabi_ic_candidate_request_free);
 }
 
 static Bool
@@ -2196,22 +2467,22 @@ nabi_ic_update_candidate_window_with_key(NabiIC *ic, const char* key)
     }
 
     nabi_log(6, "lookup string: %s\n", normalized);
-    if (nabi_server->hanja_mode && ic->client_text == NULL)
-	list = hanja_table_match_prefix(nabi_server->symbol_table, normalized);
-    else if (nabi_server->commit_by_word && ic->client_text == NULL)
-	list = hanja_table_match_prefix(nabi_server->symbol_table, normalized);
+    if (ic->server->hanja_mode && ic->client_text == NULL)
+	list = hanja_table_match_prefix(ic->server->symbol_table, normalized);
+    else if (ic->server->commit_by_word && ic->client_text == NULL)
+	list = hanja_table_match_prefix(ic->server->symbol_table, normalized);
     else
-	list = hanja_table_match_suffix(nabi_server->symbol_table, normalized);
+	list = hanja_table_match_suffix(ic->server->symbol_table, normalized);
 
     if (list == NULL) {
-	if (nabi_server->hanja_mode && ic->client_text == NULL)
-	    list = hanja_table_match_prefix(nabi_server->hanja_table,
+	if (ic->server->hanja_mode && ic->client_text == NULL)
+	    list = hanja_table_match_prefix(ic->server->hanja_table,
 					    normalized);
-	else if (nabi_server->commit_by_word && ic->client_text == NULL)
-	    list = hanja_table_match_prefix(nabi_server->hanja_table,
+	else if (ic->server->commit_by_word && ic->client_text == NULL)
+	    list = hanja_table_match_prefix(ic->server->hanja_table,
 					    normalized);
 	else
-	    list = hanja_table_match_suffix(nabi_server->hanja_table,
+	    list = hanja_table_match_suffix(ic->server->hanja_table,
 					    normalized);
     }
 
@@ -2241,15 +2512,27 @@ nabi_ic_update_candidate_window_with_key(NabiIC *ic, const char* key)
     }
 
     if (valid_list_length > 0) {
-	if (ic->candidate != NULL) {
-	    nabi_candidate_set_hanja_list(ic->candidate,
-				list, valid_list, valid_list_length);
-	} else {
-	    ic->candidate = nabi_candidate_new(key, 9,
-				list, valid_list, valid_list_length,
-				parent, &nabi_ic_candidate_commit_cb, ic);
-	}
+	NabiCandidateRequest* request;
+
+	/* the ui owns the lists from now on */
+	request = nabi_ic_candidate_request_new(ic, NABI_CANDIDATE_SHOW);
+	request->label = g_strdup(key);
+	request->list = list;
+	request->valid_list = valid_list;
+	request->valid_list_length = valid_list_length;
+	request->parent = parent;
+	/* the options belong to the xim side, the ui gets a copy */
+	if (ic->server->candidate_font != NULL)
+	    request->font =
+		pango_font_description_copy(ic->server->candidate_font);
+	request->use_simplified_chinese = ic->server->use_simplified_chinese;
+	ic->has_candidate = True;
+	nabi_server_call_ui(ic->server, nabi_ic_candidate_request_cb, request,
+			    nabi_ic_candidate_request_free);
     } else {
+	if (list != NULL)
+	    hanja_list_delete(list);
+	g_free(valid_list);
 	nabi_ic_close_candidate_window(ic);
     }
 
@@ -2269,26 +2552,42 @@ nabi_ic_update_candidate_window(NabiIC *ic)
     return res;
 }
 
+#else
+void
+nabi_ic_close_candidate_window(NabiIC* ic)
+{
+    ic->has_candidate = False;
+}
+
+static Bool
+nabi_ic_update_candidate_window_with_key(NabiIC *ic, const char* key)
+{
+    return False;
+}
+
+static Bool
+nabi_ic_update_candidate_window(NabiIC *ic)
+{
+    return False;
+}
+#endif
+
 void
-nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja)
+nabi_ic_insert_candidate(NabiIC *ic, const char* key, const char* value)
 {
-    const char* key;
-    const char* value;
     int keylen = -1;
 
-    if (!nabi_server_is_valid_ic(nabi_server, ic))
+    if (ic == NULL)
 	return;
 
-    value = hanja_get_value(hanja);
     if (value == NULL)
 	return;
 
-    key = hanja_get_key(hanja);
     if (key != NULL)
 	keylen = g_utf8_strlen(key, -1);
 
-    if ((nabi_server->hanja_mode && ic->client_text == NULL) ||
-	(nabi_server->commit_by_word && ic->client_text == NULL)) {
+    if ((ic->server->hanja_mode && ic->client_text == NULL) ||
+	(ic->server->commit_by_word && ic->client_text == NULL)) {
 	/* 한자 모드나 단어 단위 입력에서는 prefix 방식으로 매칭하여 변환하므로
 	 * 앞에서부터 preedit text를 지워 나간다.
 	 * 그러나 client text가 있을 때에는 suffix 방식으로 검색해야 한다. */
@@ -2310,7 +2609,7 @@ nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja)
 	}
 
 	if (keylen > 0) {
-	    if (!hangul_ic_is_empty(ic->hic)) {
+	    if (!nabi_ic_is_empty(ic)) {
 		hangul_ic_reset(ic->hic);
 		keylen--;
 	    }
@@ -2328,7 +2627,7 @@ nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja)
 	 * 과 같으므로 뒤쪽부터 순서대로 지운다.*/
 	/* hangul_ic_preedit_str */
 	if (keylen > 0) {
-	    if (!hangul_ic_is_empty(ic->hic)) {
+	    if (!nabi_ic_is_empty(ic)) {
 		hangul_ic_reset(ic->hic);
 		keylen--;
 	    }
@@ -2366,20 +2665,21 @@ nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja)
 	char* preedit_left = NULL;
 	char* modified_value;
 	char* candidate;
+	const char* format;
 
 	/* nabi ic의 preedit string이 남아 있으면 그것도 commit해야지 
 	 * 그렇지 않으면 한자로 변환되지 않은 preedit string은 한자 변환후
 	 * commit된 스트링뒤에서 나타나게 된다. */
 	if (ustring_length(ic->preedit.str) > 0) {
 	    preedit_left = ustring_to_utf8(ic->preedit.str, -1);
-	    if (!nabi_server->hanja_mode && !nabi_server->commit_by_word) {
+	    if (!ic->server->hanja_mode && !ic->server->commit_by_word) {
 		ustring_clear(ic->preedit.str);
 	    }
 	} else {
 	    preedit_left = g_strdup("");
 	}
 
-	if (nabi_server->use_simplified_chinese) {
+	if (ic->server->use_simplified_chinese) {
 	    modified_value = nabi_traditional_to_simplified(value);
 	    if (!nabi_connection_is_valid_str(ic->connection, modified_value)) {
 		g_free(modified_value);
@@ -2389,22 +2689,27 @@ nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja)
 	    modified_value = g_strdup(value);
 	}
 
-	if (strcmp(nabi->config->candidate_format->str, "hanja(hangul)") == 0) {
-	    if (nabi_server->hanja_mode || nabi_server->commit_by_word)
+#ifdef NABI_XIM_ONLY
+	format = "hanja";
+#else
+	format = nabi->config->candidate_format->str;
+#endif
+	if (strcmp(format, "hanja(hangul)") == 0) {
+	    if (ic->server->hanja_mode || ic->server->commit_by_word)
 		candidate = g_strdup_printf("%s(%s)",
 				modified_value, key);
 	    else
 		candidate = g_strdup_printf("%s%s(%s)",
 				preedit_left, modified_value, key);
-	} else if (strcmp(nabi->config->candidate_format->str, "hangul(hanja)") == 0) {
-	    if (nabi_server->hanja_mode || nabi_server->commit_by_word)
+	} else if (strcmp(format, "hangul(hanja)") == 0) {
+	    if (ic->server->hanja_mode || ic->server->commit_by_word)
 		candidate = g_strdup_printf("%s(%s)",
 				key, modified_value);
 	    else
 		candidate = g_strdup_printf("%s%s(%s)",
 				preedit_left, key, modified_value);
 	} else {
-	    if (nabi_server->hanja_mode || nabi_server->commit_by_word)
+	    if (ic->server->hanja_mode || ic->server->commit_by_word)
 		candidate = g_strdup_printf("%s",
 				modified_value);
 	    else
@@ -2519,7 +2824,13 @@ nabi_ic_lookup_keysym(NabiIC* ic, XKeyEvent* event)
     KeySym keysym;
     bool is_transliteration;
 
-    is_transliteration = hangul_ic_is_transliteration(ic->hic);
+    /* with the static event flow every key comes here, even in the
+     * direct mode, so an ic which does not compose yet takes the flag
+     * of the server keyboard instead of a hic */
+    if (ic->hic != NULL)
+	is_transliteration = hangul_ic_is_transliteration(ic->hic);
+    else
+	is_transliteration = ic->server->hangul_keyboard_transliteration;
     if (is_transliteration) {
 	/* transliteration method인 경우에는 사용자의 자판 설정에서
 	 * 오는 값을 임의로 바꿔서는 안된다. 사용자 설정에 따르는 것이
@@ -2532,7 +2843,7 @@ nabi_ic_lookup_keysym(NabiIC* ic, XKeyEvent* event)
 
 	/* 자판 설정에 따른 변환 문제를 피하기 위해서 내장 keymap을 사용하여
 	 * keycode를 keysym으로 변환함 */
-	if (!nabi_server->use_system_keymap) {
+	if (!ic->server->use_system_keymap) {
 	    if (event->keycode >= 10 && event->keycode <= 61)
 		keysym = keymap[event->keycode - 10][index];
 	}
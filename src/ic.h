@@ -22,21 +22,27 @@
 
 #include <X11/Xlib.h>
 #include <glib.h>
-#include <gtk/gtk.h>
 
 #include <hangul.h>
 
 #include "../IMdkit/IMdkit.h"
 #include "../IMdkit/Xi18n.h"
 
+#ifndef NABI_XIM_ONLY
 #include "candidate.h"
+#endif
 #include "ustring.h"
+#include "preedit.h"
 
 typedef struct _PreeditAttributes PreeditAttributes;
 typedef struct _StatusAttributes StatusAttributes;
 typedef struct _NabiIC         NabiIC;
 typedef struct _NabiConnection NabiConnection;
 typedef struct _NabiToplevel   NabiToplevel;
+typedef struct _NabiICHandle   NabiICHandle;
+
+/* server.h includes this file, so the server is only declared here */
+struct _NabiServer;
 
 typedef enum {
     NABI_INPUT_MODE_DIRECT,
@@ -44,14 +50,28 @@ typedef enum {
 } NabiInputMode;
 
 struct _NabiConnection {
+    struct _NabiServer* server;
     CARD16         id;
     NabiInputMode  mode;
     GIConv         cd;
     CARD16         next_new_ic_id;
-    GSList*        ic_list;
+    NabiIC**       ic_table;        /* indexed by ic id, slot 0 is unused */
+    guint          ic_table_size;
+    Bool           async_forward;
+    Bool           utf8;            /* texts are sent as UTF8_STRING */
+};
+
+/* refers to an ic without holding a pointer to it, the generation tells
+ * a destroyed ic apart from a new one which reused the same id */
+struct _NabiICHandle {
+    struct _NabiServer* server;
+    CARD16        connect_id;
+    CARD16        id;
+    guint         generation;
 };
 
 struct _NabiToplevel {
+    struct _NabiServer* server;
     Window        id;
     NabiInputMode mode;
     unsigned int  ref;
@@ -59,7 +79,7 @@ struct _NabiToplevel {
 
 struct _PreeditAttributes {
     UString*        str;
-    GdkWindow*      window;         /* where to draw the preedit string */
+    NabiPreeditWindow* window;      /* where to draw the preedit string */
     int             width;          /* preedit area width */
     int             height;         /* preedit area height */
     XPoint          spot;           /* window position */
@@ -68,8 +88,6 @@ struct _PreeditAttributes {
     XRectangle      area_needed;    /* area needed */
 
     Colormap        cmap;           /* colormap */
-    GdkGC*          normal_gc;      /* gc */
-    GdkGC*          hilight_gc;     /* gc */
     unsigned long   foreground;     /* foreground */
     unsigned long   background;     /* background */
 
@@ -85,6 +103,8 @@ struct _PreeditAttributes {
     XIMPreeditState state;          /* preedit state */
     Bool            start;          /* preedit start */
     int		    prev_length;    /* previous preedit string length */
+    UString*        drawn;          /* preedit string the client has */
+    GArray*         drawn_feedback; /* and its feedback */
 
     gboolean        has_start_cb;   /* whether XNPreeditStartCallback
 				     * registered */
@@ -92,6 +112,7 @@ struct _PreeditAttributes {
 				     * registered */
     gboolean        has_done_cb;    /* whether XNPreeditDoneCallback 
 				     * registered */
+    gboolean        configure_pending; /* the window has to follow spot */
 };
 
 struct _StatusAttributes {
@@ -108,6 +129,7 @@ struct _StatusAttributes {
 
 struct _NabiIC {
     CARD16              id;               /* ic id */
+    guint               generation;       /* unique stamp of this ic */
     INT32               input_style;      /* input style */
     Window              client_window;    /* client window */
     Window              focus_window;     /* focus window */
@@ -116,15 +138,17 @@ struct _NabiIC {
     StatusAttributes    status;           /* status attributes */
     PreeditAttributes   preedit;          /* preedit attributes */
 
+    struct _NabiServer* server;           /* of the display of the client */
     NabiConnection*     connection;
     NabiToplevel*       toplevel;
 
     /* hangul data */
     NabiInputMode       mode;
-    HangulInputContext* hic;
+    HangulInputContext* hic;		/* NULL until the first compose */
+    char*               hic_keyboard;	/* the keyboard hic is set to */
 
-    /* hanja or symbol select window */
-    NabiCandidate*	candidate;
+    /* hanja or symbol select window, the ui owns it */
+    Bool                has_candidate;
 
     gboolean            composing_started;
     UString*            client_text;
@@ -134,14 +158,15 @@ struct _NabiIC {
 					   * registered */
 };
 
-NabiConnection* nabi_connection_create(CARD16 id, const char* encoding);
+NabiConnection* nabi_connection_create(struct _NabiServer* server,
+				       CARD16 id, const char* encoding);
 void         nabi_connection_destroy(NabiConnection* conn);
 NabiIC*      nabi_connection_create_ic(NabiConnection* conn,
 				       IMChangeICStruct* data);
 void         nabi_connection_destroy_ic(NabiConnection* conn, NabiIC* ic);
 NabiIC*      nabi_connection_get_ic(NabiConnection* conn, CARD16 id);
 
-NabiToplevel* nabi_toplevel_new(Window id);
+NabiToplevel* nabi_toplevel_new(struct _NabiServer* server, Window id);
 void          nabi_toplevel_ref(NabiToplevel* toplevel);
 void          nabi_toplevel_unref(NabiToplevel* toplevel);
 
@@ -154,6 +179,7 @@ void    nabi_ic_get_values(NabiIC *ic, IMChangeICStruct *data);
 
 Bool    nabi_ic_is_empty(NabiIC *ic);
 CARD16  nabi_ic_get_id(NabiIC* ic);
+void    nabi_ic_get_handle(NabiIC* ic, NabiICHandle* handle);
 KeySym  nabi_ic_lookup_keysym(NabiIC* ic, XKeyEvent* event);
 
 void    nabi_ic_set_focus(NabiIC *ic);
@@ -166,6 +192,8 @@ void    nabi_ic_preedit_start(NabiIC *ic);
 void    nabi_ic_preedit_done(NabiIC *ic);
 void    nabi_ic_preedit_update(NabiIC *ic);
 void    nabi_ic_preedit_clear(NabiIC *ic);
+void    nabi_ic_preedit_configure(NabiIC *ic);
+void    nabi_ic_move_spot(NabiIC *ic, const XPoint *point);
 
 void    nabi_ic_status_start(NabiIC *ic);
 void    nabi_ic_status_done(NabiIC *ic);
@@ -178,7 +206,9 @@ void    nabi_ic_flush(NabiIC *ic);
 void    nabi_ic_reset(NabiIC *ic, IMResetICStruct *data);
 
 Bool    nabi_ic_popup_candidate_window(NabiIC *ic, const char* key);
-void    nabi_ic_insert_candidate(NabiIC *ic, const Hanja* hanja);
+void    nabi_ic_close_candidate_window(NabiIC *ic);
+void    nabi_ic_insert_candidate(NabiIC *ic,
+				 const char* key, const char* value);
 
 void    nabi_ic_process_string_conversion_reply(NabiIC* ic, const char* text);
 
@@ -22,6 +22,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <langinfo.h>
 #include <signal.h>
 
@@ -60,10 +61,52 @@ nabi_x_io_error_handler(Display* display)
     exit(0);
 }
 
+static gboolean
+nabi_has_option(int argc, char *argv[], const char* option)
+{
+    int i;
+
+    for (i = 1; i < argc; i++) {
+	if (strcmp(argv[i], option) == 0)
+	    return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Serves one more display from this process. The hanja and symbol
+ * tables and the keyboard layouts are shared with the other servers. */
+static void
+nabi_add_display(const char* name, const char* xim_name)
+{
+    GdkDisplay* gdk_display;
+    Display* display;
+    NabiServer* server;
+
+    gdk_display = gdk_display_open(name);
+    if (gdk_display == NULL) {
+	nabi_log(1, "can't open display: %s\n", name);
+	return;
+    }
+
+    display = GDK_DISPLAY_XDISPLAY(gdk_display);
+    if (nabi_server_is_running(display, xim_name)) {
+	nabi_log(1, "xim %s is already running on %s\n", xim_name, name);
+	gdk_display_close(gdk_display);
+	return;
+    }
+
+    server = nabi_server_new(display, DefaultScreen(display), xim_name);
+    nabi_app_setup_server(server);
+    nabi_server_start(server);
+    nabi_log(1, "serve display: %s\n", name);
+}
+
 int
 main(int argc, char *argv[])
 {
     GtkWidget *widget;
+    Display* xim_display = NULL;
 
 #ifdef ENABLE_NLS
     bindtextdomain(PACKAGE, LOCALEDIR);
@@ -71,6 +114,14 @@ main(int argc, char *argv[])
     textdomain(PACKAGE);
 #endif
 
+    /* XIM 서버를 별도의 쓰레드에서 돌리려면 Xlib와 gdk를 초기화하기
+     * 전에 쓰레드 지원을 켜야 한다 */
+    if (nabi_has_option(argc, argv, "--xim-thread")) {
+	XInitThreads();
+	g_thread_init(NULL);
+	gdk_threads_init();
+    }
+
     gtk_init(&argc, &argv);
 
     nabi_log_set_device("stdout");
@@ -92,39 +143,85 @@ main(int argc, char *argv[])
 	else
 	    xim_name = nabi->config->xim_name->str;
 
-	if (nabi_server_is_running(xim_name)) {
+	display = gdk_x11_get_default_xdisplay();
+	screen = gdk_x11_get_default_screen();
+
+	if (nabi_server_is_running(display, xim_name)) {
 	    nabi_log(1, "xim %s is already running\n", xim_name);
 	    goto quit;
 	}
 
-	display = gdk_x11_get_default_xdisplay();
-	screen = gdk_x11_get_default_screen();
+	/* XIM 쓰레드는 gdk와 display 연결을 같이 쓰지 않는다 */
+	if (nabi->xim_thread) {
+	    xim_display = XOpenDisplay(DisplayString(display));
+	    if (xim_display == NULL) {
+		nabi_log(1, "can't open display for xim thread, "
+			    "run in the main thread\n");
+		nabi->xim_thread = FALSE;
+	    } else {
+		display = xim_display;
+	    }
+	}
 
 	nabi_server = nabi_server_new(display, screen, xim_name);
-	nabi_app_setup_server();
+	nabi_app_setup_server(nabi_server);
     }
 
     widget = nabi_app_create_palette();
     gtk_widget_show(widget);
 
     if (nabi_server != NULL) {
-	nabi_server_start(nabi_server);
+	if (nabi->xim_thread)
+	    nabi_server_start_thread(nabi_server);
+	else
+	    nabi_server_start(nabi_server);
+
+	/* the other displays are served on the gtk main loop, the
+	 * palette and the tray icon are on the default display only */
+	if (nabi->displays != NULL) {
+	    char *xim_name;
+	    int i;
+
+	    xim_name = nabi_server->name;
+	    for (i = 0; nabi->displays[i] != NULL; i++) {
+		if (nabi->displays[i][0] != '\0')
+		    nabi_add_display(nabi->displays[i], xim_name);
+	    }
+	}
     }
 
     if (nabi_log_get_level() == 0)
 	nabi_session_open(nabi->session_id);
 
+    GDK_THREADS_ENTER();
     gtk_main();
+    GDK_THREADS_LEAVE();
 
     if (nabi_log_get_level() == 0)
 	nabi_session_close();
 
     if (nabi_server != NULL) {
-	nabi_server_stop(nabi_server);
+	/* servers of the other displays, after the default one */
+	while (g_slist_length(nabi_server_get_list()) > 1) {
+	    NabiServer* server = g_slist_last(nabi_server_get_list())->data;
+	    GdkDisplay* gdk_display = server->gdk_display;
+
+	    nabi_server_stop(server);
+	    nabi_server_destroy(server);
+	    gdk_display_close(gdk_display);
+	}
+
+	if (nabi->xim_thread)
+	    nabi_server_stop_thread(nabi_server);
+	else
+	    nabi_server_stop(nabi_server);
 	nabi_server_write_log(nabi_server);
 	nabi_server_destroy(nabi_server);
 	nabi_server = NULL;
     }
+
+    if (xim_display != NULL)
+	XCloseDisplay(xim_display);
     
 quit:
     nabi_app_free();
@@ -23,6 +23,7 @@
 #include <X11/Xlib.h>
 
 #include "conf.h"
+#include "server.h"
 
 typedef struct _NabiApplication NabiApplication;
 
@@ -33,6 +34,8 @@ struct _NabiApplication {
     GtkWidget*      keyboard_button;
     GtkWidget*      tray_icon;
     gboolean	    status_only;
+    gboolean	    xim_thread;
+    gchar**	    displays;	    /* more displays to serve */
     gchar*	    session_id;
 
     int             icon_size;
@@ -51,7 +54,7 @@ extern NabiApplication* nabi;
 
 void nabi_app_new(void);
 void nabi_app_init(int *argc, char ***argv);
-void nabi_app_setup_server(void);
+void nabi_app_setup_server(NabiServer* server);
 void nabi_app_quit(void);
 void nabi_app_free(void);
 void nabi_app_save_config(void);
@@ -0,0 +1,361 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <X11/Xlib.h>
+
+#include <gtk/gtk.h>
+#include <gdk/gdkx.h>
+
+#include "preedit.h"
+#include "ic.h"
+#include "server.h"
+
+/* nabi makes the preedit window with gdk and draws on it with pango */
+struct _NabiPreeditWindow {
+    NabiServer*   server;
+    GdkWindow*    window;
+    GdkGC*        normal_gc;
+    GdkGC*        hilight_gc;
+    unsigned long foreground;
+    unsigned long background;
+};
+
+/* A server running on the xim thread draws its preedit windows from
+ * there, and has to hold the gdk lock meanwhile. The servers of
+ * --displays stay on the gtk thread, which holds the lock already.
+ * Only the thread of the server gets here, so a counter in the server
+ * lets the drawing functions call each other. server->context is set
+ * before the thread starts, server->thread only after. */
+static void
+nabi_preedit_gdk_enter(NabiServer* server)
+{
+    if (server->context != NULL && server->gdk_lock_count++ == 0)
+	GDK_THREADS_ENTER();
+}
+
+static void
+nabi_preedit_gdk_leave(NabiServer* server)
+{
+    if (server->context != NULL && --server->gdk_lock_count == 0)
+	GDK_THREADS_LEAVE();
+}
+
+NabiFont*
+nabi_preedit_font_open(NabiServer* server, const char* font_desc)
+{
+    return pango_font_description_from_string(font_desc);
+}
+
+void
+nabi_preedit_font_close(NabiServer* server, NabiFont* font)
+{
+    if (font != NULL)
+	pango_font_description_free(font);
+}
+
+/* the server whose preedit windows are made on the display */
+static NabiServer*
+nabi_preedit_find_server(Display* display)
+{
+    GSList* list;
+
+    for (list = nabi_server_get_list(); list != NULL; list = list->next) {
+	NabiServer* server = (NabiServer*)list->data;
+	if (GDK_DISPLAY_XDISPLAY(server->gdk_display) == display)
+	    return server;
+    }
+
+    return NULL;
+}
+
+/* gdk reads the events of the preedit windows on the ui side, the ic
+ * handles them on the xim side. The ic may be gone by then, so the
+ * filter knows it only by its ids. */
+static GdkFilterReturn
+nabi_preedit_filter(GdkXEvent *xevent, GdkEvent *gevent, gpointer data)
+{
+    XEvent *event = (XEvent*)xevent;
+    NabiServer* server;
+
+    if (event->type != DestroyNotify && event->type != Expose)
+	return GDK_FILTER_CONTINUE;
+
+    server = nabi_preedit_find_server(event->xany.display);
+    if (server == NULL)
+	return GDK_FILTER_CONTINUE;
+
+    nabi_ic_preedit_window_event(server,
+				 GPOINTER_TO_UINT(data) >> 16,
+				 GPOINTER_TO_UINT(data) & 0xFFFF,
+				 event->xany.window, event->type);
+
+    if (event->type == DestroyNotify)
+	return GDK_FILTER_REMOVE;
+    return GDK_FILTER_CONTINUE;
+}
+
+static PangoLayout*
+nabi_preedit_window_create_pango_layout(NabiPreeditWindow* window,
+					const char* text)
+{
+    GdkScreen* screen;
+    PangoContext* context;
+    PangoLayout* layout;
+
+    screen = gdk_drawable_get_screen(window->window);
+    context = gdk_pango_context_get_for_screen(screen);
+
+    pango_context_set_font_description(context, window->server->preedit_font);
+    pango_context_set_base_dir(context, PANGO_DIRECTION_LTR);
+    pango_context_set_language(context, pango_language_from_string("ko"));
+
+    layout = pango_layout_new(context);
+    if (text != NULL)
+	pango_layout_set_text(layout, text, -1);
+
+    return layout;
+}
+
+NabiPreeditWindow*
+nabi_preedit_window_new(NabiIC* ic, Window parent)
+{
+    NabiServer* server = ic->server;
+    NabiPreeditWindow* window;
+    GdkWindow *gdk_parent;
+    GdkWindowAttr attr;
+    gint mask;
+    guint connect_id;
+    guint ic_id;
+    GdkColor fg = { 0, 0, 0, 0 };
+    GdkColor bg = { 0, 0, 0, 0 };
+
+    nabi_preedit_gdk_enter(server);
+
+    gdk_parent = gdk_window_foreign_new_for_display(server->gdk_display,
+						    parent);
+
+    attr.wclass = GDK_INPUT_OUTPUT;
+    attr.event_mask = GDK_EXPOSURE_MASK | GDK_STRUCTURE_MASK;
+    attr.window_type = GDK_WINDOW_TEMP;
+    attr.x = ic->preedit.spot.x;
+    attr.y = ic->preedit.spot.y - ic->preedit.ascent;
+    attr.width = ic->preedit.width;
+    attr.height = ic->preedit.height;
+    /* set override-redirect to true
+     * we should set this to show preedit window on qt apps */
+    attr.override_redirect = TRUE;
+    mask = GDK_WA_X | GDK_WA_Y | GDK_WA_NOREDIR;
+
+    window = g_new(NabiPreeditWindow, 1);
+    window->server = server;
+    window->foreground = ic->preedit.foreground;
+    window->background = ic->preedit.background;
+    window->window = gdk_window_new(gdk_parent, &attr, mask);
+
+    fg.pixel = window->foreground;
+    bg.pixel = window->background;
+    gdk_window_set_background(window->window, &bg);
+
+    window->normal_gc = gdk_gc_new(window->window);
+    gdk_gc_set_foreground(window->normal_gc, &fg);
+    gdk_gc_set_background(window->normal_gc, &bg);
+
+    window->hilight_gc = gdk_gc_new(window->window);
+    gdk_gc_set_foreground(window->hilight_gc, &bg);
+    gdk_gc_set_background(window->hilight_gc, &fg);
+
+    /* install our preedit window event filter */
+    connect_id = ic->connection->id;
+    ic_id = ic->id;
+    gdk_window_add_filter(window->window,
+			  nabi_preedit_filter,
+			  GUINT_TO_POINTER(connect_id << 16 | ic_id));
+    if (gdk_parent != NULL)
+	g_object_unref(G_OBJECT(gdk_parent));
+
+    nabi_preedit_gdk_leave(server);
+
+    return window;
+}
+
+void
+nabi_preedit_window_free(NabiPreeditWindow* window)
+{
+    NabiServer* server = window->server;
+
+    nabi_preedit_gdk_enter(server);
+    g_object_unref(G_OBJECT(window->normal_gc));
+    g_object_unref(G_OBJECT(window->hilight_gc));
+    nabi_preedit_gdk_leave(server);
+    g_free(window);
+}
+
+void
+nabi_preedit_window_destroy(NabiPreeditWindow* window)
+{
+    NabiServer* server = window->server;
+
+    nabi_preedit_gdk_enter(server);
+    gdk_window_destroy(window->window);
+    nabi_preedit_window_free(window);
+    nabi_preedit_gdk_leave(server);
+}
+
+void
+nabi_preedit_window_show(NabiPreeditWindow* window)
+{
+    nabi_preedit_gdk_enter(window->server);
+    gdk_window_show(window->window);
+    nabi_preedit_gdk_leave(window->server);
+}
+
+void
+nabi_preedit_window_hide(NabiPreeditWindow* window)
+{
+    nabi_preedit_gdk_enter(window->server);
+    if (gdk_window_is_visible(window->window))
+	gdk_window_hide(window->window);
+    nabi_preedit_gdk_leave(window->server);
+}
+
+void
+nabi_preedit_window_move_resize(NabiPreeditWindow* window,
+				int x, int y, int width, int height)
+{
+    nabi_preedit_gdk_enter(window->server);
+    gdk_window_move_resize(window->window, x, y, width, height);
+    nabi_preedit_gdk_leave(window->server);
+}
+
+void
+nabi_preedit_window_set_foreground(NabiPreeditWindow* window,
+				   unsigned long foreground)
+{
+    GdkColor color = { foreground, 0, 0, 0 };
+
+    window->foreground = foreground;
+
+    nabi_preedit_gdk_enter(window->server);
+    gdk_gc_set_foreground(window->normal_gc, &color);
+    gdk_gc_set_background(window->hilight_gc, &color);
+    nabi_preedit_gdk_leave(window->server);
+}
+
+void
+nabi_preedit_window_set_background(NabiPreeditWindow* window,
+				   unsigned long background)
+{
+    GdkColor color = { background, 0, 0, 0 };
+
+    window->background = background;
+
+    nabi_preedit_gdk_enter(window->server);
+    gdk_gc_set_background(window->normal_gc, &color);
+    gdk_gc_set_foreground(window->hilight_gc, &color);
+    gdk_window_set_background(window->window, &color);
+    nabi_preedit_gdk_leave(window->server);
+}
+
+Window
+nabi_preedit_window_get_xid(NabiPreeditWindow* window)
+{
+    return GDK_WINDOW_XWINDOW(window->window);
+}
+
+GC
+nabi_preedit_window_get_gc(NabiPreeditWindow* window, gboolean hilight)
+{
+    GC gc;
+
+    nabi_preedit_gdk_enter(window->server);
+    if (hilight)
+	gc = gdk_x11_gc_get_xgc(window->hilight_gc);
+    else
+	gc = gdk_x11_gc_get_xgc(window->normal_gc);
+    nabi_preedit_gdk_leave(window->server);
+
+    return gc;
+}
+
+void
+nabi_preedit_window_draw_string(NabiPreeditWindow* window, NabiIC* ic,
+				const char* normal, const char* hilight)
+{
+    PangoContext *context;
+    const PangoFontDescription *desc;
+    PangoFontMetrics *metrics;
+    int ascent;
+    PangoLayout *normal_l;
+    PangoLayout *hilight_l;
+    PangoRectangle normal_r = { 0, 0, 12, 12 };
+    PangoRectangle hilight_r = { 0, 0, 12, 12 };
+    GdkColor fg, bg;
+    GdkColormap* colormap;
+
+    nabi_preedit_gdk_enter(window->server);
+
+    normal_l = nabi_preedit_window_create_pango_layout(window, normal);
+    pango_layout_get_pixel_extents(normal_l, NULL, &normal_r);
+
+    hilight_l = nabi_preedit_window_create_pango_layout(window, hilight);
+    pango_layout_get_pixel_extents(hilight_l, NULL, &hilight_r);
+
+    fg = window->server->preedit_fg;
+    bg = window->server->preedit_bg;
+    colormap = gdk_drawable_get_colormap(window->window);
+    if (colormap != NULL) {
+	gdk_colormap_query_color(colormap, window->foreground, &fg);
+	gdk_colormap_query_color(colormap, window->background, &bg);
+    }
+
+    context = pango_layout_get_context(hilight_l);
+    desc = pango_layout_get_font_description(hilight_l);
+    metrics = pango_context_get_metrics(context, desc,
+				 pango_language_from_string("ko"));
+
+    ascent = pango_font_metrics_get_ascent(metrics);
+    ic->preedit.ascent = PANGO_PIXELS(ascent);
+    ic->preedit.descent = normal_r.height - ic->preedit.ascent;
+
+    ic->preedit.width = normal_r.width + hilight_r.height + 3;
+    ic->preedit.height = MAX(normal_r.height, hilight_r.height) + 3;
+    nabi_ic_preedit_configure(ic);
+
+    gdk_window_clear(window->window);
+
+    gdk_draw_layout_with_colors(window->window, window->normal_gc,
+				1, 1, normal_l, &fg, &bg);
+    gdk_draw_layout_with_colors(window->window, window->hilight_gc,
+				1 + normal_r.width, 1, hilight_l, &bg, &fg);
+
+    if (normal_r.width > 0) {
+	int w = normal_r.width + hilight_r.width;
+	int h = MAX(normal_r.height, hilight_r.height);
+	gdk_draw_line(window->window, window->normal_gc, 1, h, 1 + w, h);
+    }
+
+    g_object_unref(G_OBJECT(normal_l));
+    g_object_unref(G_OBJECT(hilight_l));
+
+    nabi_preedit_gdk_leave(window->server);
+}
+/* vim: set ts=8 sw=4 sts=4 : */
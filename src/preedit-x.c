@@ -0,0 +1,340 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/Xft/Xft.h>
+
+#include "preedit.h"
+#include "ic.h"
+#include "server.h"
+
+/* nabi-xim keeps the preedit window as a plain X window and draws on it
+ * with Xft */
+struct _NabiPreeditWindow {
+    NabiServer*   server;
+    Window        window;
+    XftDraw*      draw;           /* xft drawable of the window */
+    GC            normal_gc;
+    GC            hilight_gc;
+    Colormap      cmap;           /* of the parent */
+    unsigned long foreground;
+    unsigned long background;
+    XftColor      xft_fg;         /* foreground and background, */
+    XftColor      xft_bg;         /* resolved in cmap */
+    XPointer      filter_data;
+};
+
+/* Xlib internal */
+void _XRegisterFilterByMask(Display*, Window, unsigned long,
+		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
+void _XUnregisterFilter(Display*, Window,
+		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
+
+/* The config keeps the font as a pango description like "Sans 9",
+ * xft wants the family and the size apart. */
+NabiFont*
+nabi_preedit_font_open(NabiServer* server, const char* font_desc)
+{
+    XftFont* font;
+    char* family;
+    char* p;
+    double size = 9.0;
+
+    family = g_strdup(font_desc);
+    p = strrchr(family, ' ');
+    if (p != NULL && g_ascii_isdigit(p[1])) {
+	size = g_ascii_strtod(p + 1, NULL);
+	*p = '\0';
+    }
+
+    font = XftFontOpen(server->display, server->screen,
+		       FC_FAMILY, FcTypeString, family,
+		       FC_SIZE, FcTypeDouble, size,
+		       FC_LANG, FcTypeString, "ko",
+		       NULL);
+    g_free(family);
+
+    return font;
+}
+
+void
+nabi_preedit_font_close(NabiServer* server, NabiFont* font)
+{
+    if (font != NULL)
+	XftFontClose(server->display, font);
+}
+
+/* The colors of the ic are pixels of the client's colormap, xft wants
+ * them as rgb. They are looked up once, whenever the pixels change, not
+ * on every draw. */
+static void
+nabi_preedit_window_update_xft_colors(NabiPreeditWindow* window)
+{
+    XColor colors[2];
+
+    colors[0].pixel = window->foreground;
+    colors[1].pixel = window->background;
+    XQueryColors(window->server->display, window->cmap, colors, 2);
+
+    window->xft_fg.pixel = colors[0].pixel;
+    window->xft_fg.color.red = colors[0].red;
+    window->xft_fg.color.green = colors[0].green;
+    window->xft_fg.color.blue = colors[0].blue;
+    window->xft_fg.color.alpha = 0xffff;
+    window->xft_bg.pixel = colors[1].pixel;
+    window->xft_bg.color.red = colors[1].red;
+    window->xft_bg.color.green = colors[1].green;
+    window->xft_bg.color.blue = colors[1].blue;
+    window->xft_bg.color.alpha = 0xffff;
+}
+
+/* the server whose preedit windows are made on the display */
+static NabiServer*
+nabi_preedit_find_server(Display* display)
+{
+    GSList* list;
+
+    for (list = nabi_server_get_list(); list != NULL; list = list->next) {
+	NabiServer* server = (NabiServer*)list->data;
+	if (server->display == display)
+	    return server;
+    }
+
+    return NULL;
+}
+
+/* Without gdk the preedit windows get their events through
+ * XFilterEvent(), the same way IMdkit gets those of the xim window.
+ * The ic may be gone by then, so the filter knows it only by its ids. */
+static Bool
+nabi_preedit_filter(Display *display, Window window,
+		    XEvent *event, XPointer data)
+{
+    NabiServer* server;
+
+    if (event->type != DestroyNotify && event->type != Expose)
+	return False;
+
+    server = nabi_preedit_find_server(display);
+    if (server == NULL)
+	return False;
+
+    nabi_ic_preedit_window_event(server,
+				 GPOINTER_TO_UINT(data) >> 16,
+				 GPOINTER_TO_UINT(data) & 0xFFFF,
+				 event->xany.window, event->type);
+    return True;
+}
+
+NabiPreeditWindow*
+nabi_preedit_window_new(NabiIC* ic, Window parent)
+{
+    Display* display = ic->server->display;
+    NabiPreeditWindow* window;
+    XWindowAttributes parent_attr;
+    XSetWindowAttributes attr;
+    unsigned long mask;
+
+    /* the window takes the visual of the parent, so the colors of the
+     * client are good for it */
+    if (!XGetWindowAttributes(display, parent, &parent_attr))
+	return NULL;
+
+    window = g_new(NabiPreeditWindow, 1);
+    window->server = ic->server;
+    window->cmap = parent_attr.colormap;
+    window->foreground = ic->preedit.foreground;
+    window->background = ic->preedit.background;
+    window->filter_data =
+	(XPointer)GUINT_TO_POINTER((guint)ic->connection->id << 16 | ic->id);
+    nabi_preedit_window_update_xft_colors(window);
+
+    /* set override-redirect to true
+     * we should set this to show preedit window on qt apps */
+    attr.override_redirect = True;
+    attr.background_pixel = window->background;
+    attr.border_pixel = window->foreground;
+    attr.colormap = parent_attr.colormap;
+    attr.event_mask = ExposureMask | StructureNotifyMask;
+    mask = CWOverrideRedirect | CWBackPixel | CWBorderPixel |
+	   CWColormap | CWEventMask;
+
+    window->window = XCreateWindow(display, parent,
+			    ic->preedit.spot.x,
+			    ic->preedit.spot.y - ic->preedit.ascent,
+			    ic->preedit.width, ic->preedit.height, 0,
+			    parent_attr.depth, InputOutput,
+			    parent_attr.visual, mask, &attr);
+
+    window->draw = XftDrawCreate(display, window->window,
+				 parent_attr.visual, parent_attr.colormap);
+
+    window->normal_gc = XCreateGC(display, window->window, 0, NULL);
+    XSetForeground(display, window->normal_gc, window->foreground);
+    XSetBackground(display, window->normal_gc, window->background);
+
+    window->hilight_gc = XCreateGC(display, window->window, 0, NULL);
+    XSetForeground(display, window->hilight_gc, window->background);
+    XSetBackground(display, window->hilight_gc, window->foreground);
+
+    /* install our preedit window event filter */
+    _XRegisterFilterByMask(display, window->window,
+			   ExposureMask | StructureNotifyMask,
+			   nabi_preedit_filter, window->filter_data);
+
+    return window;
+}
+
+void
+nabi_preedit_window_free(NabiPreeditWindow* window)
+{
+    Display* display = window->server->display;
+
+    _XUnregisterFilter(display, window->window,
+		       nabi_preedit_filter, window->filter_data);
+    if (window->draw != NULL)
+	XftDrawDestroy(window->draw);
+    XFreeGC(display, window->normal_gc);
+    XFreeGC(display, window->hilight_gc);
+    g_free(window);
+}
+
+void
+nabi_preedit_window_destroy(NabiPreeditWindow* window)
+{
+    Display* display = window->server->display;
+    Window xid = window->window;
+
+    nabi_preedit_window_free(window);
+    XDestroyWindow(display, xid);
+}
+
+void
+nabi_preedit_window_show(NabiPreeditWindow* window)
+{
+    XMapRaised(window->server->display, window->window);
+}
+
+void
+nabi_preedit_window_hide(NabiPreeditWindow* window)
+{
+    XUnmapWindow(window->server->display, window->window);
+}
+
+void
+nabi_preedit_window_move_resize(NabiPreeditWindow* window,
+				int x, int y, int width, int height)
+{
+    XMoveResizeWindow(window->server->display, window->window,
+		      x, y, width, height);
+}
+
+void
+nabi_preedit_window_set_foreground(NabiPreeditWindow* window,
+				   unsigned long foreground)
+{
+    Display* display = window->server->display;
+
+    window->foreground = foreground;
+    nabi_preedit_window_update_xft_colors(window);
+
+    XSetForeground(display, window->normal_gc, foreground);
+    XSetBackground(display, window->hilight_gc, foreground);
+}
+
+void
+nabi_preedit_window_set_background(NabiPreeditWindow* window,
+				   unsigned long background)
+{
+    Display* display = window->server->display;
+
+    window->background = background;
+    nabi_preedit_window_update_xft_colors(window);
+
+    XSetBackground(display, window->normal_gc, background);
+    XSetForeground(display, window->hilight_gc, background);
+    XSetWindowBackground(display, window->window, background);
+}
+
+Window
+nabi_preedit_window_get_xid(NabiPreeditWindow* window)
+{
+    return window->window;
+}
+
+GC
+nabi_preedit_window_get_gc(NabiPreeditWindow* window, gboolean hilight)
+{
+    return hilight ? window->hilight_gc : window->normal_gc;
+}
+
+void
+nabi_preedit_window_draw_string(NabiPreeditWindow* window, NabiIC* ic,
+				const char* normal, const char* hilight)
+{
+    Display* display = window->server->display;
+    XftFont* font = window->server->preedit_font;
+    XGlyphInfo normal_r = { 0, };
+    XGlyphInfo hilight_r = { 0, };
+    int normal_len;
+    int hilight_len;
+    int h;
+
+    if (window->draw == NULL || font == NULL)
+	return;
+
+    normal_len = strlen(normal);
+    hilight_len = strlen(hilight);
+    XftTextExtentsUtf8(display, font, (FcChar8*)normal, normal_len,
+		       &normal_r);
+    XftTextExtentsUtf8(display, font, (FcChar8*)hilight, hilight_len,
+		       &hilight_r);
+
+    h = font->ascent + font->descent;
+    ic->preedit.ascent = font->ascent;
+    ic->preedit.descent = font->descent;
+    ic->preedit.width = normal_r.xOff + hilight_r.xOff + 3;
+    ic->preedit.height = h + 3;
+    nabi_ic_preedit_configure(ic);
+
+    XClearWindow(display, window->window);
+
+    XftDrawStringUtf8(window->draw, &window->xft_fg, font,
+		      1, 1 + font->ascent, (FcChar8*)normal, normal_len);
+    if (hilight_len > 0) {
+	XftDrawRect(window->draw, &window->xft_fg,
+		    1 + normal_r.xOff, 1, hilight_r.xOff, h);
+	XftDrawStringUtf8(window->draw, &window->xft_bg, font,
+			  1 + normal_r.xOff, 1 + font->ascent,
+			  (FcChar8*)hilight, hilight_len);
+    }
+
+    if (normal_r.xOff > 0) {
+	int w = normal_r.xOff + hilight_r.xOff;
+	XDrawLine(display, window->window, window->normal_gc,
+		  1, h, 1 + w, h);
+    }
+}
+/* vim: set ts=8 sw=4 sts=4 : */
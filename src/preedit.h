@@ -0,0 +1,81 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifndef nabi_preedit_h
+#define nabi_preedit_h
+
+#include <X11/Xlib.h>
+#include <glib.h>
+
+/* The window the preedit string is drawn in, for the clients which do
+ * not draw it themselves. nabi makes it with gdk (preedit-gdk.c),
+ * nabi-xim with Xlib and Xft (preedit-x.c). The ic only goes through
+ * the functions below, each backend defines them. */
+#ifdef NABI_XIM_ONLY
+#include <X11/Xft/Xft.h>
+typedef XColor   NabiColor;
+typedef XftFont  NabiFont;
+#else
+#include <gtk/gtk.h>
+typedef GdkColor NabiColor;
+typedef PangoFontDescription NabiFont;
+#endif
+
+typedef struct _NabiPreeditWindow NabiPreeditWindow;
+
+struct _NabiIC;
+struct _NabiServer;
+
+/* font is a pango description like "Sans 9" */
+NabiFont* nabi_preedit_font_open (struct _NabiServer* server,
+				  const char* font_desc);
+void      nabi_preedit_font_close(struct _NabiServer* server, NabiFont* font);
+
+NabiPreeditWindow* nabi_preedit_window_new(struct _NabiIC* ic, Window parent);
+void    nabi_preedit_window_destroy    (NabiPreeditWindow* window);
+/* the X window is gone already, frees the rest */
+void    nabi_preedit_window_free       (NabiPreeditWindow* window);
+
+void    nabi_preedit_window_show       (NabiPreeditWindow* window);
+void    nabi_preedit_window_hide       (NabiPreeditWindow* window);
+void    nabi_preedit_window_move_resize(NabiPreeditWindow* window,
+					int x, int y, int width, int height);
+void    nabi_preedit_window_set_foreground(NabiPreeditWindow* window,
+					   unsigned long foreground);
+void    nabi_preedit_window_set_background(NabiPreeditWindow* window,
+					   unsigned long background);
+
+/* for drawing with the fontset of the client */
+Window  nabi_preedit_window_get_xid    (NabiPreeditWindow* window);
+GC      nabi_preedit_window_get_gc     (NabiPreeditWindow* window,
+					gboolean hilight);
+
+/* draws with the font of the server, sets the size of the preedit
+ * area of the ic and configures the window to it */
+void    nabi_preedit_window_draw_string(NabiPreeditWindow* window,
+					struct _NabiIC* ic,
+					const char* normal,
+					const char* hilight);
+
+/* defined in ic.c, the backends pass the Expose and DestroyNotify
+ * events of the window on with it, from whatever thread reads them */
+void    nabi_ic_preedit_window_event(struct _NabiServer* server,
+				     guint connect_id, guint ic_id,
+				     Window window, int type);
+
+#endif /* nabi_preedit_h */
@@ -48,6 +48,102 @@ static GtkTreeModel* trigger_key_model = NULL;
 static GtkTreeModel* off_key_model = NULL;
 static GtkTreeModel* candidate_key_model = NULL;
 
+/* A change of an option, applied to every server on its xim thread.
+ * The server may run its own thread with --xim-thread, so the dialog
+ * must not touch it directly. */
+typedef struct {
+    NabiServer* server;
+    void      (*set_str)(NabiServer*, const char*);
+    void      (*set_keys)(NabiServer*, char**);
+    void      (*set_int)(NabiServer*, int);
+    char*       str;
+    char**      keys;
+    int         value;
+} NabiPrefChange;
+
+static void
+nabi_pref_change_free(gpointer data)
+{
+    NabiPrefChange* change = (NabiPrefChange*)data;
+
+    g_free(change->str);
+    g_strfreev(change->keys);
+    g_free(change);
+}
+
+static void
+nabi_pref_change_cb(gpointer data)
+{
+    NabiPrefChange* change = (NabiPrefChange*)data;
+
+    if (change->set_str != NULL)
+	change->set_str(change->server, change->str);
+    else if (change->set_keys != NULL)
+	change->set_keys(change->server, change->keys);
+    else if (change->set_int != NULL)
+	change->set_int(change->server, change->value);
+
+    nabi_pref_change_free(change);
+}
+
+static void
+nabi_pref_apply(NabiPrefChange* proto)
+{
+    GSList* list;
+
+    for (list = nabi_server_get_list(); list != NULL; list = list->next) {
+	NabiPrefChange* change = g_new(NabiPrefChange, 1);
+	*change = *proto;
+	change->server = (NabiServer*)list->data;
+	change->str = g_strdup(proto->str);
+	change->keys = g_strdupv(proto->keys);
+	nabi_server_call_xim(change->server, nabi_pref_change_cb, change,
+			     nabi_pref_change_free);
+    }
+}
+
+static void
+nabi_pref_set_str(void (*func)(NabiServer*, const char*), const char* str)
+{
+    NabiPrefChange proto = { NULL, NULL, NULL, NULL, NULL, NULL, 0 };
+
+    proto.set_str = func;
+    proto.str = (char*)str;
+    nabi_pref_apply(&proto);
+}
+
+static void
+nabi_pref_set_keys(void (*func)(NabiServer*, char**), char** keys)
+{
+    NabiPrefChange proto = { NULL, NULL, NULL, NULL, NULL, NULL, 0 };
+
+    proto.set_keys = func;
+    proto.keys = keys;
+    nabi_pref_apply(&proto);
+}
+
+static void
+nabi_pref_set_int(void (*func)(NabiServer*, int), int value)
+{
+    NabiPrefChange proto = { NULL, NULL, NULL, NULL, NULL, NULL, 0 };
+
+    proto.set_int = func;
+    proto.value = value;
+    nabi_pref_apply(&proto);
+}
+
+static void
+nabi_pref_set_default_input_mode(NabiServer* server, int mode)
+{
+    nabi_server_set_default_input_mode(server, (NabiInputMode)mode);
+}
+
+static void
+nabi_pref_set_input_mode_scope(NabiServer* server, int scope)
+{
+    nabi_server_set_input_mode_scope(server, (NabiInputModeScope)scope);
+}
+
 static GdkPixbuf *
 load_resized_icons_from_file(const gchar *base_filename, int size)
 {
@@ -366,7 +462,7 @@ on_latin_keyboard_changed(GtkComboBox *widget, gpointer data)
     NabiKeyboardLayout* item = g_list_nth_data(nabi_server->layouts, i);
     if (item != NULL) {
 	g_string_assign(config->latin_keyboard, item->name);
-	nabi_server_set_keyboard_layout(nabi_server, item->name);
+	nabi_pref_set_str(nabi_server_set_keyboard_layout, item->name);
 
 	nabi_log(4, "preference: set latin keyboard: %s\n",
 		    config->latin_keyboard->str);
@@ -379,7 +475,7 @@ on_use_system_keymap_button_toggled(GtkToggleButton *button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->use_system_keymap = flag;
-    nabi_server_set_use_system_keymap(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_use_system_keymap, flag);
 
     gtk_widget_set_sensitive(GTK_WIDGET(data), config->use_system_keymap);
 
@@ -560,7 +656,7 @@ update_trigger_keys_setting(GtkTreeModel *model)
 
     joined = g_strjoinv(",", keys);
     g_string_assign(config->trigger_keys, joined);
-    nabi_server_set_trigger_keys(nabi_server, keys);
+    nabi_pref_set_keys(nabi_server_set_trigger_keys, keys);
     g_free(joined);
     g_strfreev(keys);
 
@@ -576,7 +672,7 @@ update_off_keys_setting(GtkTreeModel *model)
 
     joined = g_strjoinv(",", keys);
     g_string_assign(config->off_keys, joined);
-    nabi_server_set_off_keys(nabi_server, keys);
+    nabi_pref_set_keys(nabi_server_set_off_keys, keys);
     g_free(joined);
     g_strfreev(keys);
 
@@ -708,7 +804,7 @@ update_candidate_keys_setting(GtkTreeModel *model)
 
     joined = g_strjoinv(",", keys);
     g_string_assign(config->candidate_keys, joined);
-    nabi_server_set_candidate_keys(nabi_server, keys);
+    nabi_pref_set_keys(nabi_server_set_candidate_keys, keys);
     g_free(joined);
     g_strfreev(keys);
 
@@ -871,7 +967,7 @@ on_candidate_font_button_clicked(GtkWidget *button, gpointer data)
     if (result == GTK_RESPONSE_OK) {
 	char *font = gtk_font_selection_dialog_get_font_name(GTK_FONT_SELECTION_DIALOG(dialog));
 	g_string_assign(config->candidate_font, font);
-	nabi_server_set_candidate_font(nabi_server, font);
+	nabi_pref_set_str(nabi_server_set_candidate_font, font);
 	candidate_font_button_set_labels(button, font);
 	nabi_log(4, "preference: set candidate font: %s\n",
 		    config->candidate_font->str);
@@ -885,7 +981,7 @@ on_simplified_chinese_toggled(GtkToggleButton* button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->use_simplified_chinese = flag;
-    nabi_server_set_simplified_chinese(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_simplified_chinese, flag);
 
     nabi_log(4, "preference: set use simplified chinese: %d\n", flag);
 }
@@ -984,7 +1080,7 @@ on_xim_name_changed(GtkEntry* entry, gpointer data)
     const char* name = gtk_entry_get_text(GTK_ENTRY(entry));
 
     g_string_assign(config->xim_name, name);
-    nabi_server_set_xim_name(nabi_server, name);
+    nabi_pref_set_str(nabi_server_set_xim_name, name);
 
     nabi_log(4, "preference: set xim name: %s\n", name);
 }
@@ -995,7 +1091,7 @@ on_event_flow_button_toggled(GtkToggleButton *button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->use_dynamic_event_flow = flag;
-    nabi_server_set_dynamic_event_flow(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_dynamic_event_flow, flag);
 
     nabi_log(4, "preference: set use dynamic event flow: %d\n", flag);
 }
@@ -1006,7 +1102,7 @@ on_commit_by_word_button_toggled(GtkToggleButton *button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->commit_by_word = flag;
-    nabi_server_set_commit_by_word(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_commit_by_word, flag);
 
     nabi_log(4, "preference: set commit by word: %d\n", flag);
 }
@@ -1017,7 +1113,7 @@ on_auto_reorder_button_toggled(GtkToggleButton *button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->auto_reorder = flag;
-    nabi_server_set_auto_reorder(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_auto_reorder, flag);
 
     nabi_log(4, "preference: set auto reorder: %d\n", flag);
 }
@@ -1028,7 +1124,7 @@ on_ignore_app_fontset_button_toggled(GtkToggleButton *button, gpointer data)
     gboolean flag = gtk_toggle_button_get_active(button);
 
     config->ignore_app_fontset = flag;
-    nabi_server_set_ignore_app_fontset(nabi_server, flag);
+    nabi_pref_set_int(nabi_server_set_ignore_app_fontset, flag);
 
     nabi_log(4, "preference: set ignore app fontset: %d\n", flag);
 }
@@ -1040,10 +1136,12 @@ on_default_input_mode_button_toggled(GtkToggleButton *button, gpointer data)
 
     if (flag) {
 	g_string_assign(config->default_input_mode, "compose");
-	nabi_server_set_default_input_mode(nabi_server, NABI_INPUT_MODE_COMPOSE);
+	nabi_pref_set_int(nabi_pref_set_default_input_mode,
+			  NABI_INPUT_MODE_COMPOSE);
     } else {
 	g_string_assign(config->default_input_mode, "direct");
-	nabi_server_set_default_input_mode(nabi_server, NABI_INPUT_MODE_DIRECT);
+	nabi_pref_set_int(nabi_pref_set_default_input_mode,
+			  NABI_INPUT_MODE_DIRECT);
     }
 
     nabi_log(4, "preference: set default input mode: %s\n",
@@ -1075,7 +1173,7 @@ on_input_mode_scope_changed(GtkComboBox* combo_box, gpointer data)
     }
 
     g_string_assign(config->input_mode_scope, input_mode_scope_str);
-    nabi_server_set_input_mode_scope(nabi_server, input_mode_scope);
+    nabi_pref_set_int(nabi_pref_set_input_mode_scope, input_mode_scope);
 
     nabi_log(4, "preference: set input mode scope: %s\n",
 		config->input_mode_scope->str);
@@ -1088,7 +1186,7 @@ on_preedit_font_changed(GtkFontButton* widget, gpointer data)
     font_desc = gtk_font_button_get_font_name(widget);
 
     g_string_assign(config->preedit_font, font_desc);
-    nabi_server_set_preedit_font(nabi_server, font_desc);
+    nabi_pref_set_str(nabi_server_set_preedit_font, font_desc);
 
     nabi_log(4, "preference: set preedit font: %s\n",
 		config->preedit_font->str);
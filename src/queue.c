@@ -0,0 +1,147 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "queue.h"
+#include "debug.h"
+
+typedef struct {
+    NabiQueueFunc func;
+    gpointer      data;
+} NabiQueueItem;
+
+/* A ring of calls. Only the pushing thread moves head and only the
+ * consumer moves tail, so each side needs just atomic loads and stores.
+ * A byte on the pipe wakes the consumer up when it may be sleeping in
+ * poll(). */
+struct _NabiQueue {
+    NabiQueueItem* items;
+    guint          size;		/* power of two */
+    volatile gint  head;		/* next item to fill */
+    volatile gint  tail;		/* next item to run */
+    volatile gint  signaled;	/* a wakeup byte is on the pipe */
+    int            pipe[2];
+    GSource*       source;
+};
+
+static gboolean
+nabi_queue_dispatch(GIOChannel* channel, GIOCondition condition,
+		    gpointer data)
+{
+    NabiQueue* queue = (NabiQueue*)data;
+    char buf[16];
+    gint head;
+    gint tail;
+
+    while (read(queue->pipe[0], buf, sizeof(buf)) > 0)
+	continue;
+    /* a push from now on has to wake us up again */
+    g_atomic_int_set(&queue->signaled, 0);
+
+    head = g_atomic_int_get(&queue->head);
+    tail = queue->tail;
+    while (tail != head) {
+	NabiQueueItem item = queue->items[(guint)tail & (queue->size - 1)];
+	tail++;
+	g_atomic_int_set(&queue->tail, tail);
+	item.func(item.data);
+    }
+
+    return TRUE;
+}
+
+NabiQueue*
+nabi_queue_new(guint size, GMainContext* context)
+{
+    NabiQueue* queue;
+    GIOChannel* channel;
+    guint n = 1;
+
+    while (n < size)
+	n <<= 1;
+
+    queue = g_new(NabiQueue, 1);
+    if (pipe(queue->pipe) != 0) {
+	g_free(queue);
+	return NULL;
+    }
+    fcntl(queue->pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(queue->pipe[1], F_SETFL, O_NONBLOCK);
+
+    queue->items = g_new(NabiQueueItem, n);
+    queue->size = n;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->signaled = 0;
+
+    channel = g_io_channel_unix_new(queue->pipe[0]);
+    queue->source = g_io_create_watch(channel, G_IO_IN);
+    g_source_set_callback(queue->source, (GSourceFunc)nabi_queue_dispatch,
+			  queue, NULL);
+    g_source_attach(queue->source, context);
+    g_io_channel_unref(channel);
+
+    return queue;
+}
+
+/* calls still in the queue are dropped */
+void
+nabi_queue_free(NabiQueue* queue)
+{
+    if (queue == NULL)
+	return;
+
+    g_source_destroy(queue->source);
+    g_source_unref(queue->source);
+    close(queue->pipe[0]);
+    close(queue->pipe[1]);
+    g_free(queue->items);
+    g_free(queue);
+}
+
+/* Returns FALSE when the queue is full, then the call is not made and
+ * the caller still owns data. */
+gboolean
+nabi_queue_push(NabiQueue* queue, NabiQueueFunc func, gpointer data)
+{
+    gint head = queue->head;
+    NabiQueueItem* item;
+
+    if ((guint)(head - g_atomic_int_get(&queue->tail)) >= queue->size) {
+	nabi_log(1, "queue is full, call dropped\n");
+	return FALSE;
+    }
+
+    item = &queue->items[(guint)head & (queue->size - 1)];
+    item->func = func;
+    item->data = data;
+    g_atomic_int_set(&queue->head, head + 1);
+
+    if (g_atomic_int_compare_and_exchange(&queue->signaled, 0, 1)) {
+	char c = 0;
+	write(queue->pipe[1], &c, 1);
+    }
+
+    return TRUE;
+}
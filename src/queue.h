@@ -0,0 +1,34 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+#ifndef nabi_queue_h
+#define nabi_queue_h
+
+#include <glib.h>
+
+/* A queue of calls from one thread to another. There has to be exactly
+ * one thread pushing and one main context running the calls, then
+ * neither side ever takes a lock. */
+typedef struct _NabiQueue NabiQueue;
+typedef void (*NabiQueueFunc)(gpointer data);
+
+NabiQueue* nabi_queue_new(guint size, GMainContext* context);
+void       nabi_queue_free(NabiQueue* queue);
+gboolean   nabi_queue_push(NabiQueue* queue, NabiQueueFunc func, gpointer data);
+
+#endif /* nabi_queue_h */
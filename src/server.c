@@ -21,24 +21,31 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <stdarg.h>
 #include <errno.h>
 #include <sys/types.h>
 #include <dirent.h>
 #include <locale.h>
 #include <time.h>
+#include <unistd.h>
 
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
 
 #include <glib.h>
+#ifndef NABI_XIM_ONLY
 #include <gtk/gtk.h>
 #include <gdk/gdkx.h>
+#endif
 
 #include "debug.h"
 #include "gettext.h"
 #include "server.h"
+#include "../IMdkit/Xi18nTr.h"
 #include "fontset.h"
+#include "conf.h"
 #include "hangul.h"
 
 #define NABI_SYMBOL_TABLE NABI_DATA_DIR G_DIR_SEPARATOR_S "symbol.txt"
@@ -47,9 +54,23 @@
 /* from handler.c */
 Bool nabi_handler(XIMS ims, IMProtocol *call_data);
 
-static void nabi_server_delete_layouts(NabiServer* server);
+static void nabi_server_delete_layouts(GList* layouts);
+static guint nabi_server_attach_source(NabiServer* server, GSource* source);
+static void nabi_server_remove_source(NabiServer* server, guint id);
+static void nabi_server_clear_toplevel_windows(NabiServer* server);
+
+/* Xlib internal */
+void _XRegisterFilterByMask(Display*, Window, unsigned long,
+		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
+void _XUnregisterFilter(Display*, Window,
+		Bool (*filter)(Display*, Window, XEvent*, XPointer), XPointer);
 
-long nabi_filter_mask = KeyPressMask | KeyReleaseMask;
+/* Only key presses are forwarded to us. A release never changes the
+ * preedit state, and forwarding it would only send it back to the client,
+ * with another sync round trip, so clients deliver releases themselves.
+ * This is used as the forward mask of XIM_SET_EVENT_MASK, for all ics in
+ * static event flow and for composing ics in dynamic event flow. */
+long nabi_filter_mask = KeyPressMask;
 
 /* Supported Inputstyles */
 static XIMStyle nabi_input_styles[] = {
@@ -61,7 +82,10 @@ static XIMStyle nabi_input_styles[] = {
     0
 };
 
+/* in the order of preference, a client which can take UTF8_STRING gets
+ * texts as they are in nabi, without a conversion to COMPOUND_TEXT */
 static XIMEncoding nabi_encodings[] = {
+    "UTF8_STRING",
     "COMPOUND_TEXT",
     NULL
 };
@@ -274,11 +298,69 @@ static char *nabi_locales[] = {
     NULL
 };
 
+/* Tables which never change once loaded. All servers of the process,
+ * one per display, use the same copy. */
+static struct {
+    int                 ref;
+    NabiHangulKeyboard* hangul_keyboard_list;
+    HanjaTable*         hanja_table;
+    HanjaTable*         symbol_table;
+    GList*              layouts;
+} nabi_shared = { 0, NULL, NULL, NULL, NULL };
+
+/* all servers of the process, in the order they were created */
+static GSList* nabi_server_list = NULL;
+
+static void
+nabi_shared_ref(void)
+{
+    unsigned i;
+    unsigned n;
+
+    if (nabi_shared.ref++ > 0)
+	return;
+
+    /* init keyboard list from libhangul */
+    n = hangul_ic_get_n_keyboards();
+    nabi_shared.hangul_keyboard_list = g_new(NabiHangulKeyboard, n + 1);
+    for (i = 0; i < n; ++i) {
+	const char* id = hangul_ic_get_keyboard_id(i);
+	const char* name = hangul_ic_get_keyboard_name(i);
+	nabi_shared.hangul_keyboard_list[i].id = id;
+	nabi_shared.hangul_keyboard_list[i].name= name;
+    }
+    nabi_shared.hangul_keyboard_list[i].id = NULL;
+    nabi_shared.hangul_keyboard_list[i].name= NULL;
+
+    nabi_shared.hanja_table = hanja_table_load(NULL);
+    nabi_shared.symbol_table = hanja_table_load(NABI_SYMBOL_TABLE);
+}
+
+static void
+nabi_shared_unref(void)
+{
+    if (--nabi_shared.ref > 0)
+	return;
+
+    nabi_server_delete_layouts(nabi_shared.layouts);
+    nabi_shared.layouts = NULL;
+
+    if (nabi_shared.hanja_table != NULL)
+	hanja_table_delete(nabi_shared.hanja_table);
+    nabi_shared.hanja_table = NULL;
+
+    if (nabi_shared.symbol_table != NULL)
+	hanja_table_delete(nabi_shared.symbol_table);
+    nabi_shared.symbol_table = NULL;
+
+    g_free(nabi_shared.hangul_keyboard_list);
+    nabi_shared.hangul_keyboard_list = NULL;
+}
+
 NabiServer*
 nabi_server_new(Display* display, int screen, const char *name)
 {
     unsigned i;
-    unsigned n;
     const char *charset;
     char *trigger_keys[3]   = { "Hangul", "Shift+space", NULL };
     char *off_keys[2]       = { "Escape", NULL };
@@ -291,6 +373,14 @@ nabi_server_new(Display* display, int screen, const char *name)
     server->display = display;
     server->screen = screen;
 
+#ifndef NABI_XIM_ONLY
+    /* with --xim-thread the display is not the one of gdk, the preedit
+     * windows are still made with gdk on the default display then */
+    server->gdk_display = gdk_x11_lookup_xdisplay(display);
+    if (server->gdk_display == NULL)
+	server->gdk_display = gdk_display_get_default();
+#endif
+
     /* server var */
     if (name == NULL)
 	server->name = strdup(PACKAGE);
@@ -320,35 +410,45 @@ nabi_server_new(Display* display, int screen, const char *name)
 	/* We add current locale to nabi support  locales array,
 	 * so whatever the locale string is, if its encoding is utf8,
 	 * nabi support the locale */
-	for (i = 0; server->locales[i] != NULL; i++)
-	    continue;
-	server->locales[i] = setlocale(LC_CTYPE, NULL);
+	const char* locale = setlocale(LC_CTYPE, NULL);
+
+	for (i = 0; server->locales[i] != NULL; i++) {
+	    if (strcmp(server->locales[i], locale) == 0)
+		break;
+	}
+	if (server->locales[i] == NULL)
+	    server->locales[i] = (char*)locale;
     }
 
     /* connection list */
     server->connections = NULL;
+    server->connection_table = g_ptr_array_new();
 
-    /* toplevel window list */
-    server->toplevels = NULL;
+    /* toplevel windows */
+    server->toplevels = g_hash_table_new(g_direct_hash, g_direct_equal);
+    server->toplevel_windows = g_hash_table_new(g_direct_hash,
+						g_direct_equal);
+    server->configure_queue = g_array_new(FALSE, FALSE, sizeof(NabiICHandle));
+    server->configure_idle = 0;
+    server->wait_source = 0;
 
     /* hangul data */
     server->layouts = NULL;
     server->layout = NULL;
     server->hangul_keyboard = NULL;
+    server->hangul_keyboard_transliteration = False;
+    server->hic_pool = g_hash_table_new_full(g_str_hash, g_str_equal,
+					     g_free, NULL);
 
-    /* init keyboard list from libhangul */
-    n = hangul_ic_get_n_keyboards();
-    server->hangul_keyboard_list = g_new(NabiHangulKeyboard, n + 1);
-    for (i = 0; i < n; ++i) {
-	const char* id = hangul_ic_get_keyboard_id(i);
-	const char* name = hangul_ic_get_keyboard_name(i);
-	server->hangul_keyboard_list[i].id = id;
-	server->hangul_keyboard_list[i].name= name;
-    }
-    server->hangul_keyboard_list[i].id = NULL;
-    server->hangul_keyboard_list[i].name= NULL;
+    /* keyboard list, hanja and symbol tables are shared */
+    nabi_shared_ref();
+    server->hangul_keyboard_list = nabi_shared.hangul_keyboard_list;
+    server->hanja_table = nabi_shared.hanja_table;
+    server->symbol_table = nabi_shared.symbol_table;
+    server->layouts = nabi_shared.layouts;
 
     server->dynamic_event_flow = True;
+    server->async_forward = False;
     server->commit_by_word = False;
     server->auto_reorder = True;
     server->hanja_mode = False;
@@ -357,12 +457,6 @@ nabi_server_new(Display* display, int screen, const char *name)
     server->input_mode_scope = NABI_INPUT_MODE_PER_TOPLEVEL;
     server->output_mode = NABI_OUTPUT_SYLLABLE;
 
-    /* hanja */
-    server->hanja_table = hanja_table_load(NULL);
-
-    /* symbol */
-    server->symbol_table = hanja_table_load(NABI_SYMBOL_TABLE);
-
     /* options */
     server->show_status = False;
     server->use_simplified_chinese = False;
@@ -376,15 +470,47 @@ nabi_server_new(Display* display, int screen, const char *name)
     server->preedit_bg.red = 0;
     server->preedit_bg.green = 0;
     server->preedit_bg.blue = 0;
-    server->preedit_font = pango_font_description_from_string("Sans 9");
+    server->preedit_font = nabi_preedit_font_open(server, "Sans 9");
+#ifndef NABI_XIM_ONLY
     server->candidate_font = pango_font_description_from_string("Sans 14");
+#endif
 
     /* statistics */
     memset(&(server->statistics), 0, sizeof(server->statistics));
 
+    server->thread = NULL;
+    server->gdk_lock_count = 0;
+    server->context = NULL;
+    server->loop = NULL;
+    server->x_source = NULL;
+    server->ui_queue = NULL;
+    server->xim_queue = NULL;
+    server->channel = NULL;
+
+    nabi_server_list = g_slist_append(nabi_server_list, server);
+
     return server;
 }
 
+static void
+nabi_server_free_toplevel(gpointer key, gpointer value, gpointer data)
+{
+    NabiToplevel* toplevel = (NabiToplevel*)value;
+
+    nabi_log(3, "remove remaining toplevel: 0x%x\n", toplevel->id);
+    g_free(toplevel);
+}
+
+static void
+nabi_server_free_hic_list(gpointer key, gpointer value, gpointer data)
+{
+    GSList* list;
+
+    for (list = (GSList*)value; list != NULL; list = list->next)
+	hangul_ic_delete((HangulInputContext*)list->data);
+    g_slist_free((GSList*)value);
+}
+
 void
 nabi_server_destroy(NabiServer *server)
 {
@@ -407,52 +533,73 @@ nabi_server_destroy(NabiServer *server)
 	g_slist_free(server->connections);
 	server->connections = NULL;
     }
+    g_ptr_array_free(server->connection_table, TRUE);
 
-    /* free remaining toplevel list */
-    if (server->toplevels != NULL) {
-	item = server->toplevels;
-	while (item != NULL) {
-	    NabiToplevel* toplevel = (NabiToplevel*)item->data;
-	    nabi_log(3, "remove remaining toplevel: 0x%x\n", toplevel->id);
-	    g_free(item->data);
-	    item = g_slist_next(item);
-	}
-	g_slist_free(server->toplevels);
-	server->toplevels = NULL;
-    }
+    if (server->configure_idle != 0)
+	nabi_server_remove_source(server, server->configure_idle);
+    g_array_free(server->configure_queue, TRUE);
+
+    /* free remaining toplevels */
+    g_hash_table_foreach(server->toplevels, nabi_server_free_toplevel, NULL);
+    g_hash_table_destroy(server->toplevels);
+    server->toplevels = NULL;
+
+    nabi_server_clear_toplevel_windows(server);
+    g_hash_table_destroy(server->toplevel_windows);
+    server->toplevel_windows = NULL;
 
     /* free remaining fontsets */
     nabi_fontset_free_all(server->display);
 
     /* keyboard */
-    nabi_server_delete_layouts(server);
     g_free(server->hangul_keyboard);
+    g_hash_table_foreach(server->hic_pool, nabi_server_free_hic_list, NULL);
+    g_hash_table_destroy(server->hic_pool);
 
-    /* delete hanja table */
-    if (server->hanja_table != NULL)
-	hanja_table_delete(server->hanja_table);
-
-    /* delete symbol table */
-    if (server->symbol_table != NULL)
-	hanja_table_delete(server->symbol_table);
-
-    /* libhangul keyboard list */
-    g_free(server->hangul_keyboard_list);
+    /* keyboard list, hanja and symbol tables */
+    nabi_shared_unref();
 
     g_free(server->trigger_keys.keylist);
     g_free(server->candidate_keys.keylist);
     g_free(server->off_keys.keylist);
 
-    pango_font_description_free(server->preedit_font);
+    nabi_preedit_font_close(server, server->preedit_font);
+#ifndef NABI_XIM_ONLY
     pango_font_description_free(server->candidate_font);
+#endif
     g_free(server->name);
 
+    nabi_server_list = g_slist_remove(nabi_server_list, server);
+
     g_free(server);
 }
 
+/* the server an IMdkit callback belongs to */
+NabiServer*
+nabi_server_get_by_xims(XIMS xims)
+{
+    GSList* list;
+
+    for (list = nabi_server_list; list != NULL; list = list->next) {
+	NabiServer* server = (NabiServer*)list->data;
+	if (server->xims == xims)
+	    return server;
+    }
+
+    return NULL;
+}
+
+GSList*
+nabi_server_get_list(void)
+{
+    return nabi_server_list;
+}
+
 void
 nabi_server_set_hangul_keyboard(NabiServer *server, const char *id)
 {
+    HangulInputContext* hic;
+
     if (server == NULL)
 	return;
 
@@ -460,6 +607,15 @@ nabi_server_set_hangul_keyboard(NabiServer *server, const char *id)
 	g_free(server->hangul_keyboard);
 
     server->hangul_keyboard = g_strdup(id);
+
+    /* libhangul only tells it through a hic, the pooled one goes to the
+     * first ic which composes with this keyboard */
+    hic = nabi_server_get_hic(server, server->hangul_keyboard);
+    server->hangul_keyboard_transliteration =
+	hangul_ic_is_transliteration(hic);
+    nabi_server_put_hic(server, server->hangul_keyboard, hic);
+
+    nabi_channel_set(server->channel, "keyboard", id);
 }
 
 void
@@ -480,6 +636,12 @@ nabi_server_set_mode_info(NabiServer *server, int state)
 
     XChangeProperty(server->display, root, property, type, 
 		    32, PropModeReplace, (unsigned char*)&data, 1);
+
+    if (server->channel != NULL) {
+	char buf[16];
+	snprintf(buf, sizeof(buf), "%d", state);
+	nabi_channel_set(server->channel, "mode", buf);
+    }
 }
 
 void
@@ -498,15 +660,23 @@ nabi_server_set_output_mode(NabiServer *server, NabiOutputMode mode)
 void
 nabi_server_set_preedit_font(NabiServer *server, const char *font_desc)
 {
-    if (server == NULL)
+    NabiFont* font;
+
+    if (server == NULL || font_desc == NULL)
 	return;
 
-    if (font_desc != NULL)
-	pango_font_description_free(server->preedit_font);
-    server->preedit_font = pango_font_description_from_string(font_desc);
+    font = nabi_preedit_font_open(server, font_desc);
+    if (font == NULL) {
+	nabi_log(1, "can't open preedit font: %s\n", font_desc);
+	return;
+    }
+
+    nabi_preedit_font_close(server, server->preedit_font);
+    server->preedit_font = font;
     nabi_log(3, "set preedit font: %s\n", font_desc);
 }
 
+#ifndef NABI_XIM_ONLY
 void
 nabi_server_set_candidate_font(NabiServer *server, const char *font_desc)
 {
@@ -518,6 +688,7 @@ nabi_server_set_candidate_font(NabiServer *server, const char *font_desc)
     server->candidate_font = pango_font_description_from_string(font_desc);
     nabi_log(3, "set candidate font: %s\n", font_desc);
 }
+#endif
 
 static void
 xim_trigger_keys_set_value(XIMTriggerKeys* keys, char** key_strings)
@@ -564,7 +735,7 @@ xim_trigger_keys_set_value(XIMTriggerKeys* keys, char** key_strings)
 		keylist[i].modifier |= Mod4Mask;
 		keylist[i].modifier_mask |= Mod4Mask;
 	    } else {
-		keylist[i].keysym = gdk_keyval_from_name(list[j]);
+		keylist[i].keysym = XStringToKeysym(list[j]);
 	    }
 	}
 	g_strfreev(list);
@@ -598,21 +769,65 @@ nabi_server_set_candidate_keys(NabiServer *server, char **keys)
     xim_trigger_keys_set_value(&server->candidate_keys, keys);
 }
 
+NabiIC*
+nabi_server_get_ic_by_handle(NabiServer* server, const NabiICHandle* handle)
+{
+    NabiIC* ic;
+
+    ic = nabi_server_get_ic(server, handle->connect_id, handle->id);
+    if (ic != NULL && ic->generation == handle->generation)
+	return ic;
+
+    return NULL;
+}
+
 gboolean
-nabi_server_is_valid_ic(NabiServer* server, NabiIC* ic)
+nabi_server_is_valid_ic(NabiServer* server, const NabiICHandle* handle)
 {
-    GSList* item = server->connections;
+    return nabi_server_get_ic_by_handle(server, handle) != NULL;
+}
+
+static gboolean
+nabi_server_configure_preedits(gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+    guint i;
 
-    while (item != NULL) {
-	NabiConnection* conn = (NabiConnection*)item->data;
-	if (g_slist_find(conn->ic_list, ic) != NULL)
-	    return TRUE;
-	item = g_slist_next(item);
+    for (i = 0; i < server->configure_queue->len; i++) {
+	NabiICHandle* handle;
+	NabiIC* ic;
+
+	handle = &g_array_index(server->configure_queue, NabiICHandle, i);
+	ic = nabi_server_get_ic_by_handle(server, handle);
+	if (ic != NULL && ic->preedit.configure_pending)
+	    nabi_ic_preedit_configure(ic);
     }
+    g_array_set_size(server->configure_queue, 0);
 
+    server->configure_idle = 0;
     return FALSE;
 }
 
+/* The preedit window of the ic is moved after all the X events read
+ * together are handled, so a burst of caret moves moves it only once.
+ * The idle runs before gdk redraws. */
+void
+nabi_server_queue_preedit_configure(NabiServer* server, NabiIC* ic)
+{
+    NabiICHandle handle;
+
+    nabi_ic_get_handle(ic, &handle);
+    g_array_append_val(server->configure_queue, handle);
+
+    if (server->configure_idle == 0) {
+	GSource* source = g_idle_source_new();
+	g_source_set_priority(source, G_PRIORITY_HIGH_IDLE);
+	g_source_set_callback(source, nabi_server_configure_preedits,
+			      server, NULL);
+	server->configure_idle = nabi_server_attach_source(server, source);
+    }
+}
+
 NabiIC*
 nabi_server_get_ic(NabiServer *server, CARD16 connect_id, CARD16 ic_id)
 {
@@ -665,15 +880,12 @@ nabi_server_is_candidate_key(NabiServer* server, KeySym key, unsigned int state)
 }
 
 Bool
-nabi_server_is_running(const char* name)
+nabi_server_is_running(Display* display, const char* name)
 {
-    Display* display;
     Atom atom;
     Window owner;
     char atom_name[64];
 
-    display = gdk_x11_get_default_xdisplay();
-
     snprintf(atom_name, sizeof(atom_name), "@server=%s", name);
 
     atom = XInternAtom(display, atom_name, True);
@@ -686,6 +898,137 @@ nabi_server_is_running(const char* name)
     return False;
 }
 
+static gboolean
+nabi_server_internal_connection_cb(GIOChannel* channel,
+				   GIOCondition condition, gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    XProcessInternalConnection(server->display,
+			       g_io_channel_unix_get_fd(channel));
+    return TRUE;
+}
+
+/* IMdkit registers the local/ transport sockets as Xlib internal
+ * connections, we poll them from the glib main loop */
+static void
+nabi_server_connection_watch(Display* display, XPointer client_data,
+			     int fd, Bool opening, XPointer* watch_data)
+{
+    NabiServer* server = (NabiServer*)client_data;
+
+    if (opening) {
+	GIOChannel* channel;
+	GSource* source;
+	guint id;
+
+	channel = g_io_channel_unix_new(fd);
+	source = g_io_create_watch(channel, G_IO_IN | G_IO_HUP | G_IO_ERR);
+	g_source_set_callback(source,
+			      (GSourceFunc)nabi_server_internal_connection_cb,
+			      server, NULL);
+	id = nabi_server_attach_source(server, source);
+	g_io_channel_unref(channel);
+	*watch_data = (XPointer)GUINT_TO_POINTER(id);
+    } else {
+	nabi_server_remove_source(server, GPOINTER_TO_UINT(*watch_data));
+    }
+}
+
+/* sources of the server run in its own main context with --xim-thread,
+ * otherwise in the default one */
+static guint
+nabi_server_attach_source(NabiServer* server, GSource* source)
+{
+    guint id;
+
+    id = g_source_attach(source, server->context);
+    g_source_unref(source);
+    return id;
+}
+
+static void
+nabi_server_remove_source(NabiServer* server, guint id)
+{
+    GSource* source;
+
+    source = g_main_context_find_source_by_id(server->context, id);
+    if (source != NULL)
+	g_source_destroy(source);
+}
+
+/* the status ui can change the keyboard and the hanja mode too */
+static void
+nabi_server_channel_cb(NabiChannel* channel,
+		       const char* name, const char* value, gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    if (name == NULL)
+	return;
+
+    if (strcmp(name, "keyboard") == 0)
+	nabi_server_set_hangul_keyboard(server, value);
+    else if (strcmp(name, "hanja") == 0)
+	nabi_server_set_hanja_mode(server, strcmp(value, "0") != 0);
+}
+
+/* IMdkit does not block while it waits for a reply from a client, it
+ * holds the messages of the client. This source lets them go when the
+ * reply does not come in time, even if the client sends nothing else. */
+typedef struct {
+    GSource source;
+    XIMS    xims;
+} NabiWaitSource;
+
+static gboolean
+nabi_wait_source_prepare(GSource* source, gint* timeout)
+{
+    NabiWaitSource* wait_source = (NabiWaitSource*)source;
+    long t;
+
+    t = IMWaitTimeout(wait_source->xims);
+    *timeout = t > G_MAXINT ? G_MAXINT : (gint)t;
+    return t == 0;
+}
+
+static gboolean
+nabi_wait_source_check(GSource* source)
+{
+    NabiWaitSource* wait_source = (NabiWaitSource*)source;
+
+    return IMWaitTimeout(wait_source->xims) == 0;
+}
+
+static gboolean
+nabi_wait_source_dispatch(GSource* source, GSourceFunc callback,
+			  gpointer data)
+{
+    NabiWaitSource* wait_source = (NabiWaitSource*)source;
+
+    IMExpireWaits(wait_source->xims);
+    return TRUE;
+}
+
+static GSourceFuncs nabi_wait_source_funcs = {
+    nabi_wait_source_prepare,
+    nabi_wait_source_check,
+    nabi_wait_source_dispatch,
+    NULL
+};
+
+static GSource*
+nabi_wait_source_new(XIMS xims)
+{
+    NabiWaitSource* wait_source;
+
+    wait_source = (NabiWaitSource*)g_source_new(&nabi_wait_source_funcs,
+						sizeof(NabiWaitSource));
+    wait_source->xims = xims;
+
+    return (GSource*)wait_source;
+}
+
 int
 nabi_server_start(NabiServer *server)
 {
@@ -694,6 +1037,8 @@ nabi_server_start(NabiServer *server)
     XIMStyles input_styles;
     XIMEncodings encodings;
     char *locales;
+    char *transport;
+    char *path;
 
     if (server == NULL)
 	return 0;
@@ -713,22 +1058,35 @@ nabi_server_start(NabiServer *server)
 		    / sizeof(XIMEncoding) - 1;
     encodings.supported_encodings = nabi_encodings;
 
+    /* clients on this host can talk to us over a unix socket
+     * without going through the X server */
+    transport = g_strdup_printf("X/,local/%s:%s/nabi-%d.%d",
+				g_get_host_name(), XIM_LOCAL_DIR,
+				(int)getpid(),
+				g_slist_index(nabi_server_list, server));
+    XAddConnectionWatch(server->display,
+			nabi_server_connection_watch, (XPointer)server);
+
     locales = g_strjoinv(",", server->locales);
     xims = IMOpenIM(server->display,
 		   IMModifiers, "Xi18n",
 		   IMServerWindow, window,
 		   IMServerName, server->name,
 		   IMLocale, locales,
-		   IMServerTransport, "X/",
+		   IMServerTransport, transport,
 		   IMInputStyles, &input_styles,
 		   NULL);
     g_free(locales);
+    g_free(transport);
 
     if (xims == NULL) {
 	nabi_log(1, "can't open input method service\n");
 	exit(1);
     }
 
+    server->wait_source = nabi_server_attach_source(server,
+					    nabi_wait_source_new(xims));
+
     if (server->dynamic_event_flow) {
 	IMSetIMValues(xims,
 		      IMOnKeysList, &(server->trigger_keys),
@@ -746,6 +1104,18 @@ nabi_server_start(NabiServer *server)
 
     server->start_time = time(NULL);
 
+    /* the palette and the tray icon learn the state from the channel,
+     * we never wait for them */
+    path = nabi_channel_get_path(DisplayString(server->display),
+				 server->name);
+    server->channel = nabi_channel_listen(path, server->context,
+					  nabi_server_channel_cb, server);
+    g_free(path);
+    nabi_channel_set(server->channel, "mode", "0");
+    nabi_channel_set(server->channel, "keyboard", server->hangul_keyboard);
+    nabi_channel_set(server->channel, "hanja",
+		     server->hanja_mode ? "1" : "0");
+
     nabi_log(1, "xim server started\n");
 
     return 0;
@@ -758,14 +1128,248 @@ nabi_server_stop(NabiServer *server)
 	return 0;
 
     if (server->xims != NULL) {
+	Xi18n i18n_core = (Xi18n)server->xims->protocol;
+	Xi18nStats* stats = &i18n_core->address.stats;
+
+	nabi_log(1, "xim messages: %lu, flushes: %lu, max queue depth: %d\n",
+		 stats->messages, stats->flushes, stats->max_queue_depth);
+	nabi_log(1, "xim packets: %lu, committed chars: %d, "
+		    "messages/char: %.2f, packets/char: %.2f\n",
+		 stats->packets, server->statistics.commit,
+		 server->statistics.commit > 0 ?
+		     (double)stats->messages / server->statistics.commit : 0.0,
+		 server->statistics.commit > 0 ?
+		     (double)stats->packets / server->statistics.commit : 0.0);
+	nabi_log(1, "sync queue: max %d, processed: %lu, dropped: %lu, "
+		    "latency avg: %lu ms, max: %lu ms\n",
+		 stats->max_pending,
+		 stats->pending_processed, stats->pending_dropped,
+		 stats->pending_processed > 0 ?
+		     stats->pending_latency / stats->pending_processed : 0,
+		 stats->max_pending_latency);
+	nabi_log(1, "reply waits: %lu, stalls: %lu\n",
+		 stats->waits, stats->wait_stalls);
+
+	nabi_channel_destroy(server->channel);
+	server->channel = NULL;
+
+	nabi_server_remove_source(server, server->wait_source);
+	server->wait_source = 0;
+
 	IMCloseIM(server->xims);
 	server->xims = NULL;
+	XRemoveConnectionWatch(server->display,
+			       nabi_server_connection_watch, (XPointer)server);
     }
     nabi_log(1, "xim server stoped\n");
 
     return 0;
 }
 
+/* With its own display, the xim thread has to read the X events itself,
+ * gdk does it only for the display of the ui. IMdkit gets them through
+ * XFilterEvent(). */
+typedef struct {
+    GSource  source;
+    GPollFD  poll_fd;
+    Display* display;
+} NabiXSource;
+
+static gboolean
+nabi_x_source_prepare(GSource* source, gint* timeout)
+{
+    NabiXSource* x_source = (NabiXSource*)source;
+
+    *timeout = -1;
+    return XPending(x_source->display) > 0;
+}
+
+static gboolean
+nabi_x_source_check(GSource* source)
+{
+    NabiXSource* x_source = (NabiXSource*)source;
+
+    if (x_source->poll_fd.revents & G_IO_IN)
+	return XPending(x_source->display) > 0;
+    return FALSE;
+}
+
+static gboolean
+nabi_x_source_dispatch(GSource* source, GSourceFunc callback, gpointer data)
+{
+    NabiXSource* x_source = (NabiXSource*)source;
+    XEvent event;
+
+    while (XPending(x_source->display) > 0) {
+	XNextEvent(x_source->display, &event);
+	XFilterEvent(&event, None);
+    }
+    return TRUE;
+}
+
+static GSourceFuncs nabi_x_source_funcs = {
+    nabi_x_source_prepare,
+    nabi_x_source_check,
+    nabi_x_source_dispatch,
+    NULL
+};
+
+static GSource*
+nabi_x_source_new(Display* display)
+{
+    NabiXSource* x_source;
+
+    x_source = (NabiXSource*)g_source_new(&nabi_x_source_funcs,
+					  sizeof(NabiXSource));
+    x_source->display = display;
+    x_source->poll_fd.fd = ConnectionNumber(display);
+    x_source->poll_fd.events = G_IO_IN | G_IO_HUP | G_IO_ERR;
+    g_source_add_poll((GSource*)x_source, &x_source->poll_fd);
+
+    return (GSource*)x_source;
+}
+
+static gpointer
+nabi_server_thread_main(gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    nabi_server_start(server);
+    g_main_loop_run(server->loop);
+    nabi_server_stop(server);
+
+    return NULL;
+}
+
+/* Runs the server on a thread of its own. server->display has to be a
+ * connection which is not used by gdk, and XInitThreads() and
+ * gdk_threads_init() have to be called before gtk_init(). */
+int
+nabi_server_start_thread(NabiServer* server)
+{
+    GError* error = NULL;
+
+    if (server == NULL)
+	return 0;
+
+    if (server->thread != NULL)
+	return 0;
+
+    server->context = g_main_context_new();
+    server->loop = g_main_loop_new(server->context, FALSE);
+    server->ui_queue = nabi_queue_new(1024, NULL);
+    server->xim_queue = nabi_queue_new(1024, server->context);
+
+    server->x_source = nabi_x_source_new(server->display);
+    g_source_attach(server->x_source, server->context);
+
+    server->thread = g_thread_create(nabi_server_thread_main, server,
+				     TRUE, &error);
+    if (server->thread == NULL) {
+	nabi_log(1, "can't create xim thread: %s\n", error->message);
+	g_error_free(error);
+	exit(1);
+    }
+
+    nabi_log(1, "xim thread started\n");
+    return 0;
+}
+
+static void
+nabi_server_quit_thread(gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    g_main_loop_quit(server->loop);
+}
+
+int
+nabi_server_stop_thread(NabiServer* server)
+{
+    if (server == NULL)
+	return 0;
+
+    if (server->thread == NULL)
+	return 0;
+
+    /* the thread only ends with this call, so wait for room rather than
+     * drop it */
+    while (!nabi_queue_push(server->xim_queue, nabi_server_quit_thread, server))
+	g_usleep(10000);
+    g_thread_join(server->thread);
+    server->thread = NULL;
+
+    if (server->configure_idle != 0) {
+	nabi_server_remove_source(server, server->configure_idle);
+	server->configure_idle = 0;
+    }
+
+    g_source_destroy(server->x_source);
+    g_source_unref(server->x_source);
+    server->x_source = NULL;
+    nabi_queue_free(server->xim_queue);
+    server->xim_queue = NULL;
+    nabi_queue_free(server->ui_queue);
+    server->ui_queue = NULL;
+    g_main_loop_unref(server->loop);
+    server->loop = NULL;
+    g_main_context_unref(server->context);
+    server->context = NULL;
+
+    nabi_log(1, "xim thread stopped\n");
+    return 0;
+}
+
+/* Without gtk nobody else reads the X events, so nabi-xim runs the
+ * server on the default main context until the display goes away. */
+int
+nabi_server_run(NabiServer* server)
+{
+    if (server == NULL)
+	return 0;
+
+    server->loop = g_main_loop_new(NULL, FALSE);
+    server->x_source = nabi_x_source_new(server->display);
+    g_source_attach(server->x_source, NULL);
+
+    nabi_server_start(server);
+    g_main_loop_run(server->loop);
+    nabi_server_stop(server);
+
+    g_source_destroy(server->x_source);
+    g_source_unref(server->x_source);
+    server->x_source = NULL;
+    g_main_loop_unref(server->loop);
+    server->loop = NULL;
+
+    return 0;
+}
+
+/* Calls func on the gtk ui thread, outside of the gdk lock. Only the
+ * xim side may use this. Without the xim thread it is called right away.
+ * func owns data, but when the queue is full the call is dropped and
+ * destroy frees data instead. */
+void
+nabi_server_call_ui(NabiServer* server, NabiQueueFunc func, gpointer data,
+		    GDestroyNotify destroy)
+{
+    if (server == NULL || server->ui_queue == NULL)
+	func(data);
+    else if (!nabi_queue_push(server->ui_queue, func, data) && destroy != NULL)
+	destroy(data);
+}
+
+/* Calls func on the xim side, only the ui may use this. */
+void
+nabi_server_call_xim(NabiServer* server, NabiQueueFunc func, gpointer data,
+		     GDestroyNotify destroy)
+{
+    if (server == NULL || server->xim_queue == NULL)
+	func(data);
+    else if (!nabi_queue_push(server->xim_queue, func, data) && destroy != NULL)
+	destroy(data);
+}
+
 NabiConnection*
 nabi_server_create_connection(NabiServer *server,
 			      CARD16 connect_id, const char* locale)
@@ -775,23 +1379,23 @@ nabi_server_create_connection(NabiServer *server,
     if (server == NULL)
 	return NULL;
 
-    conn = nabi_connection_create(connect_id, locale);
+    conn = nabi_connection_create(server, connect_id, locale);
     server->connections = g_slist_prepend(server->connections, conn);
+
+    /* IMdkit reuses connect_ids of closed connections, so the table
+     * grows only up to the number of clients connected at once */
+    if (connect_id >= server->connection_table->len)
+	g_ptr_array_set_size(server->connection_table, connect_id + 1);
+    g_ptr_array_index(server->connection_table, connect_id) = conn;
+
     return conn;
 }
 
 NabiConnection*
 nabi_server_get_connection(NabiServer *server, CARD16 connect_id)
 {
-    GSList* item;
-
-    item = server->connections;
-    while (item != NULL) {
-	NabiConnection* conn = (NabiConnection*)item->data;
-	if (conn != NULL && conn->id == connect_id)
-	    return conn;
-	item = g_slist_next(item);
-    }
+    if (connect_id < server->connection_table->len)
+	return g_ptr_array_index(server->connection_table, connect_id);
 
     return NULL;
 }
@@ -801,28 +1405,205 @@ nabi_server_destroy_connection(NabiServer *server, CARD16 connect_id)
 {
     NabiConnection* conn = nabi_server_get_connection(server, connect_id);
 
+    if (conn == NULL)
+	return;
+
+    g_ptr_array_index(server->connection_table, connect_id) = NULL;
     server->connections = g_slist_remove(server->connections, conn);
     nabi_connection_destroy(conn);
 }
 
+static Bool nabi_server_toplevel_window_filter(Display* display,
+					       Window window, XEvent* event,
+					       XPointer data);
+
+static void
+nabi_server_unwatch_window(gpointer key, gpointer value, gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    /* only the toplevels are watched. The event mask stays, the window
+     * may be gone already and the events without a filter are just
+     * dropped */
+    if (key == value)
+	_XUnregisterFilter(server->display, (Window)GPOINTER_TO_UINT(key),
+			   nabi_server_toplevel_window_filter,
+			   (XPointer)server);
+}
+
+static void
+nabi_server_clear_toplevel_windows(NabiServer* server)
+{
+    g_hash_table_foreach(server->toplevel_windows,
+			 nabi_server_unwatch_window, server);
+    g_hash_table_remove_all(server->toplevel_windows);
+}
+
+static gboolean
+nabi_server_is_under_toplevel(gpointer key, gpointer value, gpointer data)
+{
+    return value == data;
+}
+
+static void
+nabi_server_forget_toplevel(NabiServer* server, Window toplevel)
+{
+    gpointer key = GUINT_TO_POINTER(toplevel);
+
+    nabi_server_unwatch_window(key, key, server);
+    g_hash_table_foreach_remove(server->toplevel_windows,
+				nabi_server_is_under_toplevel, key);
+}
+
+static Bool
+nabi_server_toplevel_window_filter(Display* display, Window window,
+				   XEvent* event, XPointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    switch (event->type) {
+    case DestroyNotify:
+	/* the descendants of a destroyed window are gone too */
+	if (event->xdestroywindow.window == window)
+	    nabi_server_forget_toplevel(server, window);
+	else
+	    g_hash_table_remove(server->toplevel_windows,
+			GUINT_TO_POINTER(event->xdestroywindow.window));
+	break;
+    case ReparentNotify:
+	/* the toplevel or one of its children has moved, and the
+	 * descendants with it. We don't know them, so we forget all the
+	 * windows of this toplevel, reparenting is rare enough */
+	nabi_log(3, "window 0x%x reparented, forget toplevel 0x%x\n",
+		 event->xreparent.window, window);
+	nabi_server_forget_toplevel(server, window);
+	break;
+    default:
+	break;
+    }
+
+    return False;
+}
+
+/* Selects StructureNotify and SubstructureNotify on the toplevel, on top
+ * of what we may have selected there already, the root window mask of
+ * the ui for one, and filters them. One watch per toplevel sees it and
+ * its children move. A reparent deeper down goes unnoticed, the
+ * toolkits which embed windows reparent a toplevel of their own.
+ * Returns False if the toplevel is gone or has moved meanwhile. */
+static Bool
+nabi_server_watch_toplevel(NabiServer* server, Window toplevel)
+{
+    XWindowAttributes attr;
+    long mask = StructureNotifyMask | SubstructureNotifyMask;
+    Window root = None;
+    Window parent = None;
+    Window* children = NULL;
+    unsigned int nchildren = 0;
+    Status s;
+
+    if (!XGetWindowAttributes(server->display, toplevel, &attr))
+	return False;
+
+    if ((attr.your_event_mask & mask) != mask)
+	XSelectInput(server->display, toplevel, attr.your_event_mask | mask);
+
+    /* we see the reparents from now on, check for one before */
+    s = XQueryTree(server->display, toplevel,
+		   &root, &parent, &children, &nchildren);
+    if (children != NULL)
+	XFree(children);
+    if (!s || parent != root)
+	return False;
+
+    _XRegisterFilterByMask(server->display, toplevel, mask,
+			   nabi_server_toplevel_window_filter,
+			   (XPointer)server);
+    return True;
+}
+
+/* The toplevel of a window is its ancestor just below the root. It takes
+ * an XQueryTree round trip per level to find it, so we remember it for
+ * the window and all the ancestors on the way, and watch the toplevel
+ * to forget them when they move. */
+Window
+nabi_server_get_toplevel_window(NabiServer* server, Window window)
+{
+    Status s;
+    Window w;
+    Window toplevel;
+    Window root = None;
+    Window parent = None;
+    Window* children = NULL;
+    unsigned int nchildren = 0;
+    GSList* chain = NULL;
+    GSList* item;
+    gpointer value;
+
+    w = window;
+    while (TRUE) {
+	value = g_hash_table_lookup(server->toplevel_windows,
+				    GUINT_TO_POINTER(w));
+	if (value != NULL) {
+	    toplevel = (Window)GPOINTER_TO_UINT(value);
+	    break;
+	}
+
+	s = XQueryTree(server->display, w,
+		       &root, &parent, &children, &nchildren);
+	if (children != NULL) {
+	    XFree(children);
+	    children = NULL;
+	}
+
+	if (!s) {
+	    /* the window is gone, keep nothing of this walk */
+	    g_slist_free(chain);
+	    return w;
+	}
+
+	if (parent == None) {
+	    /* the root itself, which never moves and is not worth
+	     * watching */
+	    g_slist_free(chain);
+	    return w;
+	}
+
+	chain = g_slist_prepend(chain, GUINT_TO_POINTER(w));
+	if (parent == root) {
+	    toplevel = w;
+	    if (!nabi_server_watch_toplevel(server, toplevel)) {
+		/* gone or moved, don't remember this walk */
+		g_slist_free(chain);
+		return toplevel;
+	    }
+	    break;
+	}
+	w = parent;
+    }
+
+    for (item = chain; item != NULL; item = item->next) {
+	g_hash_table_insert(server->toplevel_windows, item->data,
+			    GUINT_TO_POINTER(toplevel));
+    }
+    g_slist_free(chain);
+
+    return toplevel;
+}
+
 NabiToplevel*
 nabi_server_get_toplevel(NabiServer* server, Window id)
 {
     NabiToplevel* toplevel;
-    GSList* item;
 
-    item = server->toplevels;
-    while (item != NULL) {
-	NabiToplevel* toplevel = (NabiToplevel*)item->data;
-	if (toplevel != NULL && toplevel->id == id) {
-	    nabi_toplevel_ref(toplevel);
-	    return toplevel;
-	}
-	item = g_slist_next(item);
+    toplevel = g_hash_table_lookup(server->toplevels, GUINT_TO_POINTER(id));
+    if (toplevel != NULL) {
+	nabi_toplevel_ref(toplevel);
+	return toplevel;
     }
 
-    toplevel = nabi_toplevel_new(id);
-    server->toplevels = g_slist_prepend(server->toplevels, toplevel);
+    toplevel = nabi_toplevel_new(server, id);
+    g_hash_table_insert(server->toplevels, GUINT_TO_POINTER(id), toplevel);
 
     return toplevel;
 }
@@ -830,8 +1611,14 @@ nabi_server_get_toplevel(NabiServer* server, Window id)
 void
 nabi_server_remove_toplevel(NabiServer* server, NabiToplevel* toplevel)
 {
-    if (server != NULL && server->toplevels != NULL)
-	server->toplevels = g_slist_remove(server->toplevels, toplevel);
+    gpointer key;
+
+    if (server == NULL || server->toplevels == NULL)
+	return;
+
+    key = GUINT_TO_POINTER(toplevel->id);
+    if (g_hash_table_lookup(server->toplevels, key) == toplevel)
+	g_hash_table_remove(server->toplevels, key);
 }
 
 Bool
@@ -879,15 +1666,16 @@ skip_space(gchar* p)
 }
 
 static void
-nabi_server_delete_layouts(NabiServer* server)
+nabi_server_delete_layouts(GList* layouts)
 {
-    if (server->layouts != NULL) {
-	g_list_foreach(server->layouts, nabi_keyboard_layout_free, NULL);
-	g_list_free(server->layouts);
-	server->layouts = NULL;
+    if (layouts != NULL) {
+	g_list_foreach(layouts, nabi_keyboard_layout_free, NULL);
+	g_list_free(layouts);
     }
 }
 
+/* The layouts are shared by all servers, a server after the first one
+ * uses what is already loaded. */
 void
 nabi_server_load_keyboard_layout(NabiServer *server, const char *filename)
 {
@@ -898,6 +1686,11 @@ nabi_server_load_keyboard_layout(NabiServer *server, const char *filename)
     GList *list = NULL;
     NabiKeyboardLayout *layout = NULL;
 
+    if (nabi_shared.layouts != NULL) {
+	server->layouts = nabi_shared.layouts;
+	return;
+    }
+
     file = fopen(filename, "r");
     if (file == NULL) {
 	fprintf(stderr, "Nabi: Failed to open keyboard layout file: %s\n", filename);
@@ -953,7 +1746,7 @@ nabi_server_load_keyboard_layout(NabiServer *server, const char *filename)
 
     fclose(file);
 
-    nabi_server_delete_layouts(server);
+    nabi_shared.layouts = list;
     server->layouts = list;
 }
 
@@ -1012,6 +1805,51 @@ nabi_server_get_current_keyboard_name(NabiServer* server)
     return nabi_server_get_keyboard_name_by_id(server, server->hangul_keyboard);
 }
 
+/* Most of the ics never leave the direct mode, so they get their
+ * HangulInputContext only when they start composing, and give it back
+ * here when they are destroyed. The next ic with the same keyboard takes
+ * it without hangul_ic_new() and hangul_ic_select_keyboard(). */
+#define NABI_HIC_POOL_SIZE 16
+
+HangulInputContext*
+nabi_server_get_hic(NabiServer* server, const char* keyboard)
+{
+    HangulInputContext* hic;
+    GSList* list;
+
+    list = g_hash_table_lookup(server->hic_pool,
+			       keyboard != NULL ? keyboard : "");
+    if (list == NULL)
+	return hangul_ic_new(keyboard);
+
+    hic = (HangulInputContext*)list->data;
+    list = g_slist_delete_link(list, list);
+    g_hash_table_insert(server->hic_pool,
+			g_strdup(keyboard != NULL ? keyboard : ""), list);
+
+    return hic;
+}
+
+void
+nabi_server_put_hic(NabiServer* server, const char* keyboard,
+		    HangulInputContext* hic)
+{
+    GSList* list;
+
+    if (keyboard == NULL)
+	keyboard = "";
+
+    list = g_hash_table_lookup(server->hic_pool, keyboard);
+    if (g_slist_length(list) >= NABI_HIC_POOL_SIZE) {
+	hangul_ic_delete(hic);
+	return;
+    }
+
+    hangul_ic_reset(hic);
+    list = g_slist_prepend(list, hic);
+    g_hash_table_insert(server->hic_pool, g_strdup(keyboard), list);
+}
+
 void
 nabi_server_toggle_input_mode(NabiServer* server)
 {
@@ -1021,11 +1859,11 @@ nabi_server_toggle_input_mode(NabiServer* server)
     if (server->input_mode_scope == NABI_INPUT_MODE_PER_DESKTOP) {
 	if (server->input_mode == NABI_INPUT_MODE_DIRECT) {
 	    server->input_mode = NABI_INPUT_MODE_COMPOSE;
-	    nabi_server_set_mode_info(nabi_server, NABI_MODE_INFO_COMPOSE);
+	    nabi_server_set_mode_info(server, NABI_MODE_INFO_COMPOSE);
 	    nabi_log(1, "change input mode: compose\n");
 	} else {
 	    server->input_mode = NABI_INPUT_MODE_DIRECT;
-	    nabi_server_set_mode_info(nabi_server, NABI_MODE_INFO_DIRECT);
+	    nabi_server_set_mode_info(server, NABI_MODE_INFO_DIRECT);
 	    nabi_log(1, "change input mode: direct\n");
 	}
     }
@@ -1038,6 +1876,13 @@ nabi_server_set_dynamic_event_flow(NabiServer* server, Bool flag)
 	server->dynamic_event_flow = flag;
 }
 
+void
+nabi_server_set_async_forward(NabiServer* server, Bool flag)
+{
+    if (server != NULL)
+	server->async_forward = flag;
+}
+
 void
 nabi_server_set_xim_name(NabiServer* server, const char* name)
 {
@@ -1078,8 +1923,10 @@ nabi_server_set_input_mode_scope(NabiServer* server, NabiInputModeScope scope)
 void
 nabi_server_set_hanja_mode(NabiServer* server, Bool flag)
 {
-    if (server != NULL)
+    if (server != NULL) {
 	server->hanja_mode = flag;
+	nabi_channel_set(server->channel, "hanja", flag ? "1" : "0");
+    }
 }
 
 void
@@ -1198,3 +2045,83 @@ nabi_server_write_log(NabiServer *server)
 
     g_free(filename);
 }
+
+/* Applies the options of the config file, but the colors which are
+ * parsed by the frontends. */
+void
+nabi_server_set_config(NabiServer* server, const NabiConfig* config)
+{
+    NabiOutputMode mode;
+    const char* option;
+    char** keys;
+
+    if (server == NULL || config == NULL)
+	return;
+
+    /* keyboard layout */
+    if (g_path_is_absolute(config->keyboard_layouts_file->str)) {
+	nabi_server_load_keyboard_layout(server,
+				     config->keyboard_layouts_file->str);
+    } else {
+	char* filename = g_build_filename(NABI_DATA_DIR,
+			      config->keyboard_layouts_file->str, NULL);
+	nabi_server_load_keyboard_layout(server, filename);
+	g_free(filename);
+    }
+    nabi_server_set_keyboard_layout(server, config->latin_keyboard->str);
+
+    /* set keyboard */
+    nabi_server_set_hangul_keyboard(server, config->hangul_keyboard->str);
+
+    mode = NABI_OUTPUT_SYLLABLE;
+    if (config->output_mode != NULL) {
+	if (g_ascii_strcasecmp(config->output_mode->str, "jamo") == 0) {
+	    mode = NABI_OUTPUT_JAMO;
+	} else if (g_ascii_strcasecmp(config->output_mode->str, "manual") == 0) {
+	    mode = NABI_OUTPUT_MANUAL;
+	}
+    }
+    nabi_server_set_output_mode(server, mode);
+
+    keys = g_strsplit(config->trigger_keys->str, ",", 0);
+    nabi_server_set_trigger_keys(server, keys);
+    g_strfreev(keys);
+    keys = g_strsplit(config->candidate_keys->str, ",", 0);
+    nabi_server_set_candidate_keys(server, keys);
+    g_strfreev(keys);
+    nabi_server_set_dynamic_event_flow(server,
+				       config->use_dynamic_event_flow);
+    nabi_server_set_async_forward(server, config->use_async_forward);
+    nabi_server_set_commit_by_word(server, config->commit_by_word);
+    nabi_server_set_auto_reorder(server, config->auto_reorder);
+    nabi_server_set_simplified_chinese(server,
+				       config->use_simplified_chinese);
+
+    option = config->default_input_mode->str;
+    if (strcmp(option, "compose") == 0) {
+	nabi_server_set_default_input_mode(server,
+					   NABI_INPUT_MODE_COMPOSE);
+    } else {
+	nabi_server_set_default_input_mode(server,
+					   NABI_INPUT_MODE_DIRECT);
+    }
+
+    option = config->input_mode_scope->str;
+    if (strcmp(option, "per_desktop") == 0) {
+	nabi_server_set_input_mode_scope(server,
+					  NABI_INPUT_MODE_PER_DESKTOP);
+    } else if (strcmp(option, "per_application") == 0) {
+	nabi_server_set_input_mode_scope(server,
+					  NABI_INPUT_MODE_PER_APPLICATION);
+    } else if (strcmp(option, "per_ic") == 0) {
+	nabi_server_set_input_mode_scope(server,
+					  NABI_INPUT_MODE_PER_IC);
+    } else {
+	nabi_server_set_input_mode_scope(server,
+					  NABI_INPUT_MODE_PER_TOPLEVEL);
+    }
+
+    nabi_server_set_preedit_font(server, config->preedit_font->str);
+    nabi_server_set_ignore_app_fontset(server, config->ignore_app_fontset);
+    nabi_server_set_use_system_keymap(server, config->use_system_keymap);
+}
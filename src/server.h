@@ -27,7 +27,6 @@
 #include <time.h>
 
 #include <glib.h>
-#include <gtk/gtk.h>
 
 #include <hangul.h>
 
@@ -35,7 +34,10 @@
 #include "../IMdkit/Xi18n.h"
 
 #include "ic.h"
+#include "conf.h"
 #include "keyboard-layout.h"
+#include "queue.h"
+#include "channel.h"
 
 typedef struct _NabiHangulKeyboard NabiHangulKeyboard;
 typedef struct _NabiServer NabiServer;
@@ -72,6 +74,7 @@ struct NabiStatistics {
     int space;
     int backspace;
     int shift;
+    int commit;			/* characters committed */
     int jamo[256];
 };
 
@@ -79,6 +82,9 @@ struct _NabiServer {
     /* XIMS */
     Display*                display;
     int                     screen;
+#ifndef NABI_XIM_ONLY
+    GdkDisplay*             gdk_display;	/* for the preedit windows */
+#endif
     char*		    name;
     XIMS                    xims;
     Window                  window;
@@ -90,26 +96,55 @@ struct _NabiServer {
 
     /* xim connection list */
     GSList*                 connections;
-    GSList*                 toplevels;
-
-    /* keyboard translate */
+    GPtrArray*              connection_table;	/* indexed by connect_id */
+    GHashTable*             toplevels;		/* NabiToplevel by window */
+    /* toplevel window of the client windows and their ancestors,
+     * until they are reparented or destroyed */
+    GHashTable*             toplevel_windows;
+
+    /* ics whose preedit window waits to be moved, as NabiICHandle */
+    GArray*                 configure_queue;
+    guint                   configure_idle;
+    /* wakes the loop when a reply from a client is overdue */
+    guint                   wait_source;
+
+    /* with --xim-thread, the protocol runs on its own thread, with its
+     * own display connection and main context, and trades calls with
+     * the gtk ui through the queues */
+    GThread*                thread;
+    GMainContext*           context;
+    GMainLoop*              loop;
+    GSource*                x_source;
+    NabiQueue*              ui_queue;
+    NabiQueue*              xim_queue;
+    /* how deep the xim thread holds the gdk lock, see preedit-gdk.c */
+    int                     gdk_lock_count;
+
+    /* the status ui listens here, it may be another process */
+    NabiChannel*            channel;
+
+    /* keyboard translate, layouts are shared by all servers */
     GList*                  layouts;
     NabiKeyboardLayout*     layout;
 
     /* hangul automata */
     char*                   hangul_keyboard;
+    /* of hangul_keyboard, so that keys are looked up without a hic */
+    Bool                    hangul_keyboard_transliteration;
     NabiHangulKeyboard*     hangul_keyboard_list;
+    /* unused HangulInputContexts by keyboard id, ics take one when
+     * they start composing */
+    GHashTable*             hic_pool;
 
     NabiOutputMode          output_mode;
 
-    /* hanja */
+    /* hanja and symbol, shared by all servers */
     HanjaTable*             hanja_table;
-
-    /* symbol */
     HanjaTable*             symbol_table;
 
     /* options */
     Bool                    dynamic_event_flow;
+    Bool                    async_forward;
     Bool                    commit_by_word;
     Bool                    auto_reorder;
     Bool                    show_status;
@@ -120,18 +155,23 @@ struct _NabiServer {
     NabiInputMode           default_input_mode;
     NabiInputMode           input_mode;
     NabiInputModeScope      input_mode_scope;
-    GdkColor                preedit_fg;
-    GdkColor                preedit_bg;
+    NabiColor               preedit_fg;
+    NabiColor               preedit_bg;
 
-    PangoFontDescription*   preedit_font;
+    NabiFont*               preedit_font;
+#ifndef NABI_XIM_ONLY
     PangoFontDescription*   candidate_font;
+#endif
 
     /* statistics */
     time_t                  start_time;
     struct NabiStatistics   statistics;
 };
 
+/* the server on the default display, which the palette and the
+ * preferences show */
 extern NabiServer* nabi_server;
+extern long nabi_filter_mask;
 
 NabiServer* nabi_server_new		(Display*    display,
 					 int         screen,
@@ -139,8 +179,20 @@ NabiServer* nabi_server_new		(Display*    display,
 void        nabi_server_destroy         (NabiServer* server);
 int         nabi_server_start           (NabiServer* server);
 int         nabi_server_stop            (NabiServer *server);
-
-Bool        nabi_server_is_running();
+int         nabi_server_start_thread    (NabiServer* server);
+int         nabi_server_stop_thread     (NabiServer* server);
+int         nabi_server_run             (NabiServer* server);
+void        nabi_server_call_ui         (NabiServer* server,
+					 NabiQueueFunc func, gpointer data,
+					 GDestroyNotify destroy);
+void        nabi_server_call_xim        (NabiServer* server,
+					 NabiQueueFunc func, gpointer data,
+					 GDestroyNotify destroy);
+
+NabiServer* nabi_server_get_by_xims     (XIMS xims);
+GSList*     nabi_server_get_list        (void);
+
+Bool        nabi_server_is_running      (Display* display, const char* name);
 Bool        nabi_server_is_trigger_key  (NabiServer*  server,
                                          KeySym       key,
                                          unsigned int state);
@@ -161,15 +213,23 @@ void        nabi_server_set_keyboard_layout(NabiServer *server,
 void        nabi_server_set_hangul_keyboard(NabiServer *server,
 					 const char *id);
 void        nabi_server_toggle_input_mode(NabiServer* server);
+HangulInputContext* nabi_server_get_hic(NabiServer* server,
+					const char* keyboard);
+void        nabi_server_put_hic         (NabiServer* server,
+					 const char* keyboard,
+					 HangulInputContext* hic);
 
 void        nabi_server_set_mode_info(NabiServer *server, int state);
 void        nabi_server_set_output_mode (NabiServer *server,
 					 NabiOutputMode mode);
 void	    nabi_server_set_preedit_font(NabiServer *server,
 					   const gchar *font_desc);
+#ifndef NABI_XIM_ONLY
 void	    nabi_server_set_candidate_font(NabiServer *server,
 					   const gchar *font_desc);
+#endif
 void        nabi_server_set_dynamic_event_flow(NabiServer* server, Bool flag);
+void        nabi_server_set_async_forward(NabiServer* server, Bool flag);
 void        nabi_server_set_xim_name(NabiServer* server, const char* name);
 void        nabi_server_set_commit_by_word(NabiServer* server, Bool flag);
 void        nabi_server_set_auto_reorder(NabiServer* server, Bool flag);
@@ -181,10 +241,17 @@ void        nabi_server_set_input_mode_scope(NabiServer* server,
 void        nabi_server_set_simplified_chinese(NabiServer* server, Bool state);
 void        nabi_server_set_ignore_app_fontset(NabiServer* server, Bool state);
 void        nabi_server_set_use_system_keymap(NabiServer* server, Bool state);
+void        nabi_server_set_config(NabiServer* server,
+				   const NabiConfig* config);
 
 NabiIC*     nabi_server_get_ic          (NabiServer *server,
 					 CARD16 connect_id, CARD16 icid);
-gboolean    nabi_server_is_valid_ic     (NabiServer* server, NabiIC* ic);
+gboolean    nabi_server_is_valid_ic     (NabiServer* server,
+					 const NabiICHandle* handle);
+NabiIC*     nabi_server_get_ic_by_handle(NabiServer* server,
+					 const NabiICHandle* handle);
+void        nabi_server_queue_preedit_configure(NabiServer* server,
+						NabiIC* ic);
 
 NabiConnection* nabi_server_create_connection (NabiServer *server,
 					       CARD16 connect_id,
@@ -194,6 +261,8 @@ NabiConnection* nabi_server_get_connection    (NabiServer *server,
 void            nabi_server_destroy_connection(NabiServer *server,
 					       CARD16 connect_id);
 
+Window          nabi_server_get_toplevel_window(NabiServer* server,
+						Window window);
 NabiToplevel*   nabi_server_get_toplevel(NabiServer* server, Window id);
 void            nabi_server_remove_toplevel(NabiServer* server,
 					    NabiToplevel* toplevel);
@@ -91,7 +91,18 @@ static GtkWidget *about_dialog = NULL;
 static GtkWidget *preference_dialog = NULL;
 static GtkWidget *hide_palette_menuitem = NULL;
 
+/* the xim server, maybe nabi-xim, tells us its state over this */
+static NabiChannel *status_channel = NULL;
+static guint status_channel_retry = 0;
+
+/* the keyboards come from libhangul, not from the server, so the palette
+ * and the tray can list them when the server runs in another process */
+static NabiHangulKeyboard *hangul_keyboard_list = NULL;
+
 static void nabi_app_load_base_icons();
+static void nabi_app_update_keyboard_name(void);
+static const NabiHangulKeyboard* nabi_app_get_hangul_keyboard_list(void);
+static const char* nabi_app_get_keyboard_name(const char* id);
 
 static void nabi_state_icon_load(NabiStateIcon* state, int w, int h);
 
@@ -119,65 +130,44 @@ static NabiPalette*  nabi_palette = NULL;
 static NabiTrayIcon* nabi_tray = NULL;
 
 static void
-load_colors(void)
+load_colors(NabiServer* server)
 {
     gboolean ret;
     GdkColor color;
     GdkColormap *colormap;
 
-    colormap = gdk_colormap_get_system();
+    colormap = gdk_screen_get_system_colormap(
+		    gdk_display_get_screen(server->gdk_display, server->screen));
 
     /* preedit foreground */
     gdk_color_parse(nabi->config->preedit_fg->str, &color);
     ret = gdk_colormap_alloc_color(colormap, &color, FALSE, TRUE);
     if (ret)
-	nabi_server->preedit_fg = color;
+	server->preedit_fg = color;
     else {
 	color.pixel = 1;
 	color.red = 0xffff;
 	color.green = 0xffff;
 	color.blue = 0xffff;
 	ret = gdk_colormap_alloc_color(colormap, &color, FALSE, TRUE);
-	nabi_server->preedit_fg = color;
+	server->preedit_fg = color;
     }
 
     /* preedit background */
     gdk_color_parse(nabi->config->preedit_bg->str, &color);
     ret = gdk_colormap_alloc_color(colormap, &color, FALSE, TRUE);
     if (ret)
-	nabi_server->preedit_bg = color;
+	server->preedit_bg = color;
     else {
 	color.pixel = 0;
 	color.red = 0;
 	color.green = 0;
 	color.blue = 0;
 	ret = gdk_colormap_alloc_color(colormap, &color, FALSE, TRUE);
-	nabi_server->preedit_fg = color;
+	server->preedit_fg = color;
     }
 }
 
-static void
-set_up_keyboard(void)
-{
-    /* keyboard layout */
-    if (g_path_is_absolute(nabi->config->keyboard_layouts_file->str)) {
-	nabi_server_load_keyboard_layout(nabi_server,
-				     nabi->config->keyboard_layouts_file->str);
-    } else {
-	char* filename = g_build_filename(NABI_DATA_DIR,
-			      nabi->config->keyboard_layouts_file->str, NULL);
-	nabi_server_load_keyboard_layout(nabi_server,
-					 filename);
-	g_free(filename);
-    }
-    nabi_server_set_keyboard_layout(nabi_server,
-				    nabi->config->latin_keyboard->str);
-
-    /* set keyboard */
-    nabi_server_set_hangul_keyboard(nabi_server,
-				    nabi->config->hangul_keyboard->str);
-}
-
 void
 nabi_app_new(void)
 {
@@ -186,6 +176,8 @@ nabi_app_new(void)
     nabi->xim_name = NULL;
     nabi->palette = NULL;
     nabi->status_only = FALSE;
+    nabi->xim_thread = FALSE;
+    nabi->displays = NULL;
     nabi->session_id = NULL;
     nabi->icon_size = 0;
 
@@ -218,6 +210,25 @@ nabi_app_init(int *argc, char ***argv)
 		strcmp("--status-only", (*argv)[i]) == 0) {
 		nabi->status_only = TRUE;
 		(*argv)[i] = NULL;
+	    } else if (strcmp("--xim-thread", (*argv)[i]) == 0) {
+		nabi->xim_thread = TRUE;
+		(*argv)[i] = NULL;
+	    } else if (strcmp("--displays", (*argv)[i]) == 0 ||
+		       strncmp("--displays=", (*argv)[i], 11) == 0) {
+		gchar *displays = (*argv)[i] + 10;
+		if (*displays == '=') {
+		    displays++;
+		} else {
+		    (*argv)[i] = NULL;
+		    i++;
+		    displays = (*argv)[i];
+		}
+		(*argv)[i] = NULL;
+
+		if (displays != NULL) {
+		    g_strfreev(nabi->displays);
+		    nabi->displays = g_strsplit(displays, ",", 0);
+		}
 	    } else if (strcmp("--sm-client-id", (*argv)[i]) == 0 ||
 		       strncmp("--sm-client-id=", (*argv)[i], 15) == 0) {
 		gchar *session_id = (*argv)[i] + 14;
@@ -297,35 +308,18 @@ nabi_app_init(int *argc, char ***argv)
     nabi_app_load_base_icons();
 }
 
-static void
-set_up_output_mode(void)
-{
-    NabiOutputMode mode;
-
-    mode = NABI_OUTPUT_SYLLABLE;
-    if (nabi->config->output_mode != NULL) {
-	if (g_ascii_strcasecmp(nabi->config->output_mode->str, "jamo") == 0) {
-	    mode = NABI_OUTPUT_JAMO;
-	} else if (g_ascii_strcasecmp(nabi->config->output_mode->str, "manual") == 0) {
-	    mode = NABI_OUTPUT_MANUAL;
-	}
-    }
-    nabi_server_set_output_mode(nabi_server, mode);
-}
-
 void
-nabi_app_setup_server(void)
+nabi_app_setup_server(NabiServer* server)
 {
     const char *locale;
-    char **keys;
-    const char* option;
 
     if (nabi->status_only)
 	return;
 
+    /* the locale is the same for all servers, one warning is enough */
     locale = setlocale(LC_CTYPE, NULL);
-    if (locale == NULL ||
-	!nabi_server_is_locale_supported(nabi_server, locale)) {
+    if (server == nabi_server && (locale == NULL ||
+	!nabi_server_is_locale_supported(server, locale))) {
 	GtkWidget *message;
 	const gchar *encoding = "";
 
@@ -345,53 +339,10 @@ nabi_app_setup_server(void)
 	gtk_widget_destroy(message);
     }
 
-    set_up_keyboard();
-    load_colors();
-    set_up_output_mode();
-    keys = g_strsplit(nabi->config->trigger_keys->str, ",", 0);
-    nabi_server_set_trigger_keys(nabi_server, keys);
-    g_strfreev(keys);
-    keys = g_strsplit(nabi->config->candidate_keys->str, ",", 0);
-    nabi_server_set_candidate_keys(nabi_server, keys);
-    g_strfreev(keys);
-    nabi_server_set_candidate_font(nabi_server,
+    nabi_server_set_config(server, nabi->config);
+    load_colors(server);
+    nabi_server_set_candidate_font(server,
 				nabi->config->candidate_font->str);
-    nabi_server_set_dynamic_event_flow(nabi_server,
-				       nabi->config->use_dynamic_event_flow);
-    nabi_server_set_commit_by_word(nabi_server, nabi->config->commit_by_word);
-    nabi_server_set_auto_reorder(nabi_server, nabi->config->auto_reorder);
-    nabi_server_set_simplified_chinese(nabi_server,
-				       nabi->config->use_simplified_chinese);
-
-    option = nabi->config->default_input_mode->str;
-    if (strcmp(option, "compose") == 0) {
-	nabi_server_set_default_input_mode(nabi_server,
-					   NABI_INPUT_MODE_COMPOSE);
-    } else {
-	nabi_server_set_default_input_mode(nabi_server,
-					   NABI_INPUT_MODE_DIRECT);
-    }
-
-    option = nabi->config->input_mode_scope->str;
-    if (strcmp(option, "per_desktop") == 0) {
-	nabi_server_set_input_mode_scope(nabi_server,
-					  NABI_INPUT_MODE_PER_DESKTOP);
-    } else if (strcmp(option, "per_application") == 0) {
-	nabi_server_set_input_mode_scope(nabi_server,
-					  NABI_INPUT_MODE_PER_APPLICATION);
-    } else if (strcmp(option, "per_ic") == 0) {
-	nabi_server_set_input_mode_scope(nabi_server,
-					  NABI_INPUT_MODE_PER_IC);
-    } else {
-	nabi_server_set_input_mode_scope(nabi_server,
-					  NABI_INPUT_MODE_PER_TOPLEVEL);
-    }
-
-    nabi_server_set_preedit_font(nabi_server, nabi->config->preedit_font->str);
-    nabi_server_set_ignore_app_fontset(nabi_server,
-				      nabi->config->ignore_app_fontset);
-    nabi_server_set_use_system_keymap(nabi_server,
-				    nabi->config->use_system_keymap);
 }
 
 void
@@ -425,6 +376,10 @@ nabi_app_free(void)
     }
 
     g_free(nabi->xim_name);
+    g_strfreev(nabi->displays);
+
+    g_free(hangul_keyboard_list);
+    hangul_keyboard_list = NULL;
 
     g_free(nabi);
     nabi = NULL;
@@ -1007,6 +962,8 @@ create_tray_icon_menu(void)
     GtkWidget* menu;
     GtkWidget* menuitem;
     GSList *radio_group = NULL;
+    const NabiHangulKeyboard* keyboards;
+    int i;
 
     menu = gtk_menu_new();
 
@@ -1047,30 +1004,24 @@ create_tray_icon_menu(void)
     gtk_menu_shell_append(GTK_MENU_SHELL(menu), menuitem);
 
     /* keyboard list */
-    if (nabi_server != NULL) {
-	int i = 0;
-	const NabiHangulKeyboard* keyboards;
-	keyboards = nabi_server_get_hangul_keyboard_list(nabi_server);
-	while (keyboards[i].id != NULL) {
-	    const char* id = keyboards[i].id;
-	    const char* name = keyboards[i].name;
-	    menuitem = gtk_radio_menu_item_new_with_label(radio_group,
-							   _(name));
-	    radio_group = gtk_radio_menu_item_get_group(GTK_RADIO_MENU_ITEM(menuitem));
-	    gtk_menu_shell_append(GTK_MENU_SHELL(menu), menuitem);
-	    g_signal_connect(G_OBJECT(menuitem), "activate",
-			     G_CALLBACK(on_menu_keyboard), (gpointer)id);
-	    if (strcmp(id, nabi->config->hangul_keyboard->str) == 0)
-		gtk_check_menu_item_set_active(GTK_CHECK_MENU_ITEM(menuitem),
-					       TRUE);
-	    i++;
-	}
-
-	/* separator */
-	menuitem = gtk_separator_menu_item_new();
+    keyboards = nabi_app_get_hangul_keyboard_list();
+    for (i = 0; keyboards[i].id != NULL; i++) {
+	const char* id = keyboards[i].id;
+	const char* name = keyboards[i].name;
+	menuitem = gtk_radio_menu_item_new_with_label(radio_group, _(name));
+	radio_group = gtk_radio_menu_item_get_group(GTK_RADIO_MENU_ITEM(menuitem));
 	gtk_menu_shell_append(GTK_MENU_SHELL(menu), menuitem);
+	g_signal_connect(G_OBJECT(menuitem), "activate",
+			 G_CALLBACK(on_menu_keyboard), (gpointer)id);
+	if (strcmp(id, nabi->config->hangul_keyboard->str) == 0)
+	    gtk_check_menu_item_set_active(GTK_CHECK_MENU_ITEM(menuitem),
+					   TRUE);
     }
 
+    /* separator */
+    menuitem = gtk_separator_menu_item_new();
+    gtk_menu_shell_append(GTK_MENU_SHELL(menu), menuitem);
+
     /* menu quit */
     menuitem = gtk_image_menu_item_new_from_stock(GTK_STOCK_QUIT, NULL);
     gtk_menu_shell_append(GTK_MENU_SHELL(menu), menuitem);
@@ -1135,7 +1086,8 @@ root_window_event_filter (GdkXEvent *gxevent, GdkEvent *event, gpointer data)
     switch (xevent->type) {
     case PropertyNotify:
 	pevent = (XPropertyEvent*)xevent;
-	if (pevent->atom == nabi->mode_info_xatom) {
+	/* the channel tells the same without a round trip */
+	if (pevent->atom == nabi->mode_info_xatom && status_channel == NULL) {
 	    int state;
 	    guchar *buf;
 	    gboolean ret;
@@ -1162,6 +1114,76 @@ root_window_event_filter (GdkXEvent *gxevent, GdkEvent *event, gpointer data)
     return GDK_FILTER_CONTINUE;
 }
 
+static gboolean status_channel_connect(gpointer data);
+
+/* io watches run without the gdk lock, which the xim thread may hold */
+static void
+on_status_channel_changed(NabiChannel* channel,
+			  const char* name, const char* value, gpointer data)
+{
+    GDK_THREADS_ENTER();
+
+    if (name == NULL) {
+	/* the server has gone, wait for the next one */
+	nabi_channel_destroy(status_channel);
+	status_channel = NULL;
+	status_channel_retry = g_timeout_add(2000, status_channel_connect, NULL);
+
+	nabi_tray_update_state(nabi_tray, 0);
+	nabi_palette_update_state(nabi_palette, 0);
+    } else if (strcmp(name, "mode") == 0) {
+	int state = strtol(value, NULL, 10);
+	nabi_tray_update_state(nabi_tray, state);
+	nabi_palette_update_state(nabi_palette, state);
+    } else if (strcmp(name, "keyboard") == 0) {
+	g_string_assign(nabi->config->hangul_keyboard, value);
+	nabi_app_update_keyboard_name();
+    } else if (strcmp(name, "hanja") == 0) {
+	nabi->config->hanja_mode = strcmp(value, "0") != 0;
+	nabi_palette_update_hanja_mode(nabi_palette, nabi->config->hanja_mode);
+    }
+
+    GDK_THREADS_LEAVE();
+}
+
+static gboolean
+status_channel_connect(gpointer data)
+{
+    const char* xim_name;
+    char* path;
+
+    if (nabi->xim_name != NULL)
+	xim_name = nabi->xim_name;
+    else
+	xim_name = nabi->config->xim_name->str;
+
+    path = nabi_channel_get_path(
+		DisplayString(GDK_WINDOW_XDISPLAY(nabi->root_window)),
+		xim_name);
+    status_channel = nabi_channel_connect(path, NULL,
+					  on_status_channel_changed, NULL);
+    g_free(path);
+
+    if (status_channel == NULL)
+	return TRUE;
+
+    status_channel_retry = 0;
+    return FALSE;
+}
+
+/* nabi starts its own server after the palette is realized, so the
+ * first try is on idle */
+static gboolean
+status_channel_start(gpointer data)
+{
+    if (status_channel_connect(NULL))
+	status_channel_retry = g_timeout_add(2000, status_channel_connect,
+					     NULL);
+    else
+	status_channel_retry = 0;
+    return FALSE;
+}
+
 static void
 install_event_filter(GtkWidget *widget)
 {
@@ -1174,12 +1196,21 @@ install_event_filter(GtkWidget *widget)
     mask = gdk_window_get_events(nabi->root_window);
     gdk_window_set_events(nabi->root_window, mask | GDK_PROPERTY_CHANGE_MASK);
     gdk_window_add_filter(nabi->root_window, root_window_event_filter, NULL);
+
+    status_channel_retry = g_idle_add(status_channel_start, NULL);
 }
 
 static void
 remove_event_filter()
 {
     gdk_window_remove_filter(nabi->root_window, root_window_event_filter, NULL);
+
+    if (status_channel_retry > 0) {
+	g_source_remove(status_channel_retry);
+	status_channel_retry = 0;
+    }
+    nabi_channel_destroy(status_channel);
+    status_channel = NULL;
 }
 
 static void
@@ -1415,7 +1446,7 @@ nabi_app_create_palette(void)
     gtk_container_add(GTK_CONTAINER(eventbox), nabi_palette->state->widget);
     gtk_widget_show(nabi_palette->state->widget);
 
-    current_keyboard_name = nabi_server_get_keyboard_name_by_id(nabi_server,
+    current_keyboard_name = nabi_app_get_keyboard_name(
 				    nabi->config->hangul_keyboard->str);
     if (current_keyboard_name != NULL) {
 	const NabiHangulKeyboard* keyboards;
@@ -1428,7 +1459,7 @@ nabi_app_create_palette(void)
 	gtk_widget_show(button);
 	nabi->keyboard_button = button;
 
-	keyboards = nabi_server_get_hangul_keyboard_list(nabi_server);
+	keyboards = nabi_app_get_hangul_keyboard_list();
 	if (keyboards != NULL) {
 	    int i;
 	    menu = gtk_menu_new();
@@ -1613,33 +1644,136 @@ nabi_app_show_palette(gboolean state)
 	nabi_palette_hide(nabi_palette);
 }
 
+typedef struct {
+    NabiServer* server;
+    gboolean    hanja_mode;
+    gchar*      keyboard;
+} NabiServerChange;
+
+static void
+nabi_app_server_change_free(gpointer data)
+{
+    NabiServerChange* change = (NabiServerChange*)data;
+
+    g_free(change->keyboard);
+    g_free(change);
+}
+
+static void
+nabi_app_set_hanja_mode_cb(gpointer data)
+{
+    NabiServerChange* change = (NabiServerChange*)data;
+
+    nabi_server_set_hanja_mode(change->server, change->hanja_mode);
+    nabi_app_server_change_free(change);
+}
+
 void
 nabi_app_set_hanja_mode(gboolean state)
 {
+    GSList* list;
+
     nabi->config->hanja_mode = state;
-    nabi_server_set_hanja_mode(nabi_server, state);
+
+    /* with "nabi -s" the server is in another process */
+    if (nabi_server == NULL)
+	nabi_channel_set(status_channel, "hanja", state ? "1" : "0");
+
+    for (list = nabi_server_get_list(); list != NULL; list = list->next) {
+	NabiServerChange* change = g_new0(NabiServerChange, 1);
+	change->server = (NabiServer*)list->data;
+	change->hanja_mode = state;
+	nabi_server_call_xim(change->server, nabi_app_set_hanja_mode_cb,
+			     change, nabi_app_server_change_free);
+    }
+}
+
+static void
+nabi_app_set_hangul_keyboard_cb(gpointer data)
+{
+    NabiServerChange* change = (NabiServerChange*)data;
+
+    nabi_server_set_hangul_keyboard(change->server, change->keyboard);
+    nabi_app_server_change_free(change);
 }
 
 void
 nabi_app_set_hangul_keyboard(const char *id)
 {
+    GSList* list;
+
     if (id == NULL)
 	g_string_assign(nabi->config->hangul_keyboard, DEFAULT_KEYBOARD);
     else
 	g_string_assign(nabi->config->hangul_keyboard, id);
 
-    nabi_server_set_hangul_keyboard(nabi_server, id);
+    if (nabi_server == NULL)
+	nabi_channel_set(status_channel, "keyboard",
+			 nabi->config->hangul_keyboard->str);
+
+    for (list = nabi_server_get_list(); list != NULL; list = list->next) {
+	NabiServerChange* change = g_new0(NabiServerChange, 1);
+	change->server = (NabiServer*)list->data;
+	change->keyboard = g_strdup(id);
+	nabi_server_call_xim(change->server, nabi_app_set_hangul_keyboard_cb,
+			     change, nabi_app_server_change_free);
+    }
+
+    nabi_app_update_keyboard_name();
+}
+
+static void
+nabi_app_update_keyboard_name(void)
+{
+    const char* name;
+
+    name = nabi_app_get_keyboard_name(nabi->config->hangul_keyboard->str);
+    if (name == NULL)
+	return;
 
     // palette의 메뉴 버튼 업데이트
-    if (nabi->keyboard_button != NULL) {
-	const char* name;
-	name = nabi_server_get_current_keyboard_name(nabi_server);
+    if (nabi->keyboard_button != NULL)
 	gtk_button_set_label(GTK_BUTTON(nabi->keyboard_button), _(name));
-    }
 
     nabi_tray_icon_update_tooltips();
 }
 
+static const NabiHangulKeyboard*
+nabi_app_get_hangul_keyboard_list(void)
+{
+    unsigned i;
+    unsigned n;
+
+    if (hangul_keyboard_list != NULL)
+	return hangul_keyboard_list;
+
+    n = hangul_ic_get_n_keyboards();
+    hangul_keyboard_list = g_new(NabiHangulKeyboard, n + 1);
+    for (i = 0; i < n; ++i) {
+	hangul_keyboard_list[i].id = hangul_ic_get_keyboard_id(i);
+	hangul_keyboard_list[i].name = hangul_ic_get_keyboard_name(i);
+    }
+    hangul_keyboard_list[i].id = NULL;
+    hangul_keyboard_list[i].name = NULL;
+
+    return hangul_keyboard_list;
+}
+
+static const char*
+nabi_app_get_keyboard_name(const char* id)
+{
+    const NabiHangulKeyboard* keyboards;
+    int i;
+
+    keyboards = nabi_app_get_hangul_keyboard_list();
+    for (i = 0; keyboards[i].id != NULL; i++) {
+	if (strcmp(id, keyboards[i].id) == 0)
+	    return keyboards[i].name;
+    }
+
+    return NULL;
+}
+
 void
 nabi_app_save_config()
 {
@@ -1654,7 +1788,7 @@ nabi_tray_icon_update_tooltips()
     if (nabi_tray != NULL && nabi_tray->icon != NULL) {
 	const char* keyboard_name;
 	char tip_text[256];
-	keyboard_name = nabi_server_get_keyboard_name_by_id(nabi_server,
+	keyboard_name = nabi_app_get_keyboard_name(
 					    nabi->config->hangul_keyboard->str);
 	snprintf(tip_text, sizeof(tip_text), _("Nabi: %s"), _(keyboard_name));
 	gtk_status_icon_set_tooltip_text(nabi_tray->icon, tip_text);
@@ -1663,7 +1797,7 @@ nabi_tray_icon_update_tooltips()
     if (nabi_tray != NULL && nabi_tray->tooltips != NULL) {
 	const char* keyboard_name;
 	char tip_text[256];
-	keyboard_name = nabi_server_get_keyboard_name_by_id(nabi_server,
+	keyboard_name = nabi_app_get_keyboard_name(
 					    nabi->config->hangul_keyboard->str);
 	snprintf(tip_text, sizeof(tip_text), _("Nabi: %s"), _(keyboard_name));
 	gtk_tooltips_set_tip(GTK_TOOLTIPS(nabi_tray->tooltips), nabi->tray_icon,
@@ -16,6 +16,8 @@
  * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
  */
 
+#include <string.h>
+
 #include "ustring.h"
 
 UString*
@@ -98,3 +100,41 @@ ustring_to_utf8(const UString* str, guint len)
 	len = str->len;
     return g_ucs4_to_utf8((const gunichar*)str->data, len, NULL, NULL, NULL);
 }
+
+/* Finds the span in which str differs from old: the first *first and the
+ * last *last chars are the same in both, and the two never overlap. With
+ * attributes, arrays of attr_size bytes a char, the attributes of those
+ * chars are the same too. */
+void
+ustring_diff(const UString* str, gconstpointer str_attr,
+	     const UString* old, gconstpointer old_attr,
+	     gsize attr_size, guint* first, guint* last)
+{
+    const ucschar* s = (const ucschar*)str->data;
+    const ucschar* o = (const ucschar*)old->data;
+    const char* sa = (const char*)str_attr;
+    const char* oa = (const char*)old_attr;
+    guint len = str->len;
+    guint old_len = old->len;
+    guint f, l;
+
+    if (sa == NULL || oa == NULL)
+	attr_size = 0;
+
+    f = 0;
+    while (f < len && f < old_len && s[f] == o[f] &&
+	   (attr_size == 0 ||
+	    memcmp(sa + f * attr_size, oa + f * attr_size, attr_size) == 0))
+	f++;
+
+    l = 0;
+    while (l < len - f && l < old_len - f &&
+	   s[len - 1 - l] == o[old_len - 1 - l] &&
+	   (attr_size == 0 ||
+	    memcmp(sa + (len - 1 - l) * attr_size,
+		   oa + (old_len - 1 - l) * attr_size, attr_size) == 0))
+	l++;
+
+    *first = f;
+    *last = l;
+}
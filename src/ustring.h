@@ -40,4 +40,8 @@ UString* ustring_append_utf8(UString* str, const char* utf8);
 
 gchar*   ustring_to_utf8(const UString* str, guint len);
 
+void     ustring_diff(const UString* str, gconstpointer str_attr,
+		      const UString* old, gconstpointer old_attr,
+		      gsize attr_size, guint* first, guint* last);
+
 #endif // nabi_ustring_h
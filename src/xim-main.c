@@ -0,0 +1,212 @@
+/* Nabi - X Input Method server for hangul
+ * Copyright (C) 2003-2009 Choe Hwanjin
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA
+ */
+
+/* nabi-xim: the xim server of nabi without gtk. It reads the same config
+ * file as nabi and tells its state to "nabi -s" over the status channel,
+ * so the palette and the tray icon run in a process of their own.
+ * With --status it starts that process by itself. */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+
+#include <X11/Xlib.h>
+#include <glib.h>
+
+#include "server.h"
+#include "conf.h"
+#include "debug.h"
+
+NabiServer* nabi_server = NULL;
+
+static int
+nabi_x_error_handler(Display *display, XErrorEvent *error)
+{
+    gchar buf[64];
+
+    XGetErrorText (display, error->error_code, buf, 63);
+    fprintf(stderr, "Nabi: X error: %s\n", buf);
+
+    return 0;
+}
+
+static int
+nabi_x_io_error_handler(Display* display)
+{
+    nabi_log(1, "x io error\n");
+
+    nabi_server_write_log(nabi_server);
+
+    exit(0);
+
+    return 0;
+}
+
+static void
+nabi_load_color(NabiServer* server, const char* spec,
+		XColor* color, unsigned long fallback)
+{
+    Colormap colormap = DefaultColormap(server->display, server->screen);
+
+    if (XParseColor(server->display, colormap, spec, color) &&
+	XAllocColor(server->display, colormap, color))
+	return;
+
+    color->pixel = fallback;
+    XQueryColor(server->display, colormap, color);
+}
+
+static void
+nabi_usage(const char* name)
+{
+    printf("usage: %s [--display DISPLAY] [--xim-name NAME] [--status] "
+	   "[-d LEVEL]\n", name);
+}
+
+/* takes "--option value" and "--option=value" */
+static const char*
+nabi_get_option_value(int argc, char *argv[], int* i, const char* option)
+{
+    size_t len = strlen(option);
+
+    if (strncmp(argv[*i], option, len) != 0)
+	return NULL;
+
+    if (argv[*i][len] == '=')
+	return argv[*i] + len + 1;
+
+    if (argv[*i][len] == '\0' && *i + 1 < argc) {
+	*i += 1;
+	return argv[*i];
+    }
+
+    return NULL;
+}
+
+/* the status ui is nabi itself, without its own server */
+static void
+nabi_spawn_status(Display* display, const char* xim_name)
+{
+    gchar* argv[] = { "nabi", "--status-only", "--xim-name", NULL, NULL };
+    GError* error = NULL;
+
+    argv[3] = (gchar*)xim_name;
+    g_setenv("DISPLAY", DisplayString(display), TRUE);
+    if (!g_spawn_async(NULL, argv, NULL, G_SPAWN_SEARCH_PATH,
+		       NULL, NULL, NULL, &error)) {
+	nabi_log(1, "can't start the status ui: %s\n", error->message);
+	g_error_free(error);
+    }
+}
+
+/* runs once the loop is up, the channel of the server listens by then */
+static gboolean
+nabi_spawn_status_idle(gpointer data)
+{
+    NabiServer* server = (NabiServer*)data;
+
+    nabi_spawn_status(server->display, server->name);
+    return FALSE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Display* display;
+    NabiConfig* config;
+    const char* display_name = NULL;
+    const char* xim_name = NULL;
+    const char* value;
+    gboolean status = FALSE;
+    int i;
+
+    setlocale(LC_ALL, "");
+
+    nabi_log_set_device("stdout");
+
+    for (i = 1; i < argc; i++) {
+	if ((value = nabi_get_option_value(argc, argv, &i,
+					   "--display")) != NULL) {
+	    display_name = value;
+	} else if ((value = nabi_get_option_value(argc, argv, &i,
+						  "--xim-name")) != NULL) {
+	    xim_name = value;
+	} else if (strcmp("--status", argv[i]) == 0) {
+	    status = TRUE;
+	} else if (strcmp("-d", argv[i]) == 0 && i + 1 < argc) {
+	    i++;
+	    nabi_log_set_level(strtol(argv[i], NULL, 10));
+	} else {
+	    nabi_usage(argv[0]);
+	    return 1;
+	}
+    }
+
+    display = XOpenDisplay(display_name);
+    if (display == NULL) {
+	nabi_log(1, "can't open display: %s\n", XDisplayName(display_name));
+	return 1;
+    }
+
+    XSetErrorHandler(nabi_x_error_handler);
+    XSetIOErrorHandler(nabi_x_io_error_handler);
+
+    config = nabi_config_new();
+    nabi_config_load(config);
+
+    /* we prefer command line option as default xim name */
+    if (xim_name == NULL)
+	xim_name = config->xim_name->str;
+
+    if (nabi_server_is_running(display, xim_name)) {
+	nabi_log(1, "xim %s is already running\n", xim_name);
+	nabi_config_delete(config);
+	XCloseDisplay(display);
+	return 0;
+    }
+
+    nabi_server = nabi_server_new(display, DefaultScreen(display), xim_name);
+    nabi_server_set_config(nabi_server, config);
+    nabi_load_color(nabi_server, config->preedit_fg->str,
+		    &nabi_server->preedit_fg,
+		    WhitePixel(display, nabi_server->screen));
+    nabi_load_color(nabi_server, config->preedit_bg->str,
+		    &nabi_server->preedit_bg,
+		    BlackPixel(display, nabi_server->screen));
+
+    if (status)
+	g_idle_add(nabi_spawn_status_idle, nabi_server);
+
+    nabi_server_run(nabi_server);
+
+    nabi_server_write_log(nabi_server);
+    nabi_server_destroy(nabi_server);
+    nabi_server = NULL;
+
+    nabi_config_delete(config);
+    XCloseDisplay(display);
+
+    return 0;
+}
+
+/* vim: set ts=8 sw=4 sts=4 : */
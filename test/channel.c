@@ -0,0 +1,199 @@
+/*
+ * Test of the status channel in src/channel.c, without X.
+ *
+ * The xim side listens on a socket in a fresh directory, the ui side
+ * connects to it, both run in one main context here. Checks the
+ * "name value" lines both ways, that a new peer gets every value the
+ * server has, that the values set while a peer does not read come to
+ * it as the last value of each name only, and that a line split over
+ * several writes, a line without a value and a too long line are
+ * handled like channel.c says.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <glib.h>
+#include "channel.h"
+
+static int failures = 0;
+
+typedef struct {
+    GString *lines;		/* "name value\n" of each call */
+    int closed;			/* calls with a NULL name */
+} Received;
+
+static Received server_got;
+static Received client_got;
+
+static void
+check(int cond, const char *what)
+{
+    if (!cond) {
+	fprintf(stderr, "channel: %s\n", what);
+	failures++;
+    }
+}
+
+static void
+check_lines(Received *got, const char *expected, const char *what)
+{
+    if (strcmp(got->lines->str, expected) != 0) {
+	fprintf(stderr, "channel: %s\n  got:      '%s'\n  expected: '%s'\n",
+		what, got->lines->str, expected);
+	failures++;
+    }
+    g_string_truncate(got->lines, 0);
+}
+
+static void
+receive(NabiChannel *channel, const char *name, const char *value,
+	gpointer data)
+{
+    Received *got = (Received *) data;
+
+    if (name == NULL)
+	got->closed++;
+    else
+	g_string_append_printf(got->lines, "%s %s\n", name, value);
+}
+
+/* runs the main context until nothing is left to do */
+static void
+run(GMainContext *context)
+{
+    int idle = 0;
+
+    /* the kernel may need a moment to pass the bytes on */
+    while (idle < 20) {
+	if (g_main_context_iteration(context, FALSE))
+	    idle = 0;
+	else {
+	    idle++;
+	    g_usleep(1000);
+	}
+    }
+}
+
+static int
+raw_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0) {
+	close(fd);
+	return -1;
+    }
+    return fd;
+}
+
+static void
+raw_send(int fd, const char *str)
+{
+    if (write(fd, str, strlen(str)) != (ssize_t) strlen(str))
+	check(0, "write to the raw socket failed");
+}
+
+int
+main(int argc, char *argv[])
+{
+    GMainContext *context;
+    NabiChannel *server;
+    NabiChannel *client;
+    char dir[] = "/tmp/nabi-channel-XXXXXX";
+    char *path;
+    char *long_line;
+    int fd;
+
+    if (mkdtemp(dir) == NULL) {
+	perror("channel: mkdtemp");
+	return 1;
+    }
+    path = g_build_filename(dir, "socket", NULL);
+
+    context = g_main_context_new();
+    server_got.lines = g_string_new(NULL);
+    client_got.lines = g_string_new(NULL);
+
+    server = nabi_channel_listen(path, context, receive, &server_got);
+    check(server != NULL, "can't listen");
+    if (server == NULL)
+	return 1;
+
+    /* values set before anybody listens */
+    nabi_channel_set(server, "mode", "direct");
+    nabi_channel_set(server, "keyboard", "2");
+
+    client = nabi_channel_connect(path, context, receive, &client_got);
+    check(client != NULL, "can't connect");
+    if (client == NULL)
+	return 1;
+    run(context);
+    check(nabi_channel_is_connected(server), "server has no peer");
+    check_lines(&client_got, "mode direct\nkeyboard 2\n",
+		"a new peer does not get the values");
+
+    /* only the last value of a name reaches a peer which does not read,
+     * and a value which did not change is not sent */
+    nabi_channel_set(server, "mode", "compose");
+    nabi_channel_set(server, "mode", "direct");
+    nabi_channel_set(server, "mode", "compose");
+    nabi_channel_set(server, "keyboard", "2");
+    run(context);
+    check_lines(&client_got, "mode compose\n", "values not coalesced");
+
+    /* the ui side sends the other way, the value may have spaces */
+    nabi_channel_set(client, "keyboard", "3 final");
+    run(context);
+    check_lines(&server_got, "keyboard 3 final\n",
+		"a value from the ui is lost");
+
+    /* a line split over writes, a line without a value */
+    fd = raw_connect(path);
+    check(fd >= 0, "can't connect the raw socket");
+    run(context);
+    raw_send(fd, "hanja o");
+    run(context);
+    raw_send(fd, "n\nnovalue\nmo");
+    run(context);
+    raw_send(fd, "de direct\n");
+    run(context);
+    check_lines(&server_got, "hanja on\nmode direct\n",
+		"split lines are not put together");
+    check(server_got.closed == 0, "a peer closed too early");
+
+    /* a line longer than any of nabi closes the peer */
+    long_line = g_strnfill(2000, 'x');
+    raw_send(fd, long_line);
+    g_free(long_line);
+    run(context);
+    check(server_got.closed == 1, "a too long line does not close the peer");
+    close(fd);
+
+    /* the ui goes away */
+    nabi_channel_destroy(client);
+    run(context);
+    check(server_got.closed == 2, "the server does not see the ui go");
+    check(!nabi_channel_is_connected(server), "server keeps a closed peer");
+
+    nabi_channel_destroy(server);
+    check(access(path, F_OK) != 0, "the socket is left behind");
+    rmdir(dir);
+    g_free(path);
+    g_main_context_unref(context);
+
+    if (failures > 0) {
+	fprintf(stderr, "channel: %d failures\n", failures);
+	return 1;
+    }
+
+    printf("channel: lines, coalescing and peers ok\n");
+    return 0;
+}
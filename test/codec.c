@@ -0,0 +1,535 @@
+/*
+ * Differential test of the hand-written codecs in IMdkit/i18nCodec.c.
+ *
+ * Every frame is encoded or decoded once by the codec and once by
+ * FrameMgr with the template from IMdkit/i18nIMProto.c which the codec
+ * names, in both byte orders and with random field values, and the two
+ * have to agree byte for byte.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include "FrameMgr.h"
+#include "IMdkit.h"
+#include "Xi18n.h"
+#include "XimFunc.h"
+
+#define ITERATIONS	2000
+#define MAX_STRING	300
+#define MAX_ATTRS	8
+
+extern XimFrameRec forward_event_fr[];
+extern XimFrameRec ext_forward_keyevent_fr[];
+extern XimFrameRec commit_chars_fr[];
+extern XimFrameRec preedit_draw_fr[];
+extern XimFrameRec create_ic_fr[];
+extern XimFrameRec set_ic_values_fr[];
+extern XimFrameRec create_ic_reply_fr[];
+extern XimFrameRec set_ic_values_reply_fr[];
+extern XimFrameRec sync_reply_fr[];
+extern XimFrameRec short_fr[];
+extern XimFrameRec long_fr[];
+extern XimFrameRec xpoint_fr[];
+extern XimFrameRec xrectangle_fr[];
+
+/* CARD32 arrays, the codecs and FrameMgr expect 4 byte alignment */
+static CARD32 fm_area[1024];
+static CARD32 codec_area[1024];
+#define FM_BUF		((unsigned char *) fm_area)
+#define CODEC_BUF	((unsigned char *) codec_area)
+
+static const char *current_frame;
+static Bool current_swap;
+static int current_iteration;
+static int failures = 0;
+
+static CARD16
+rand16(void)
+{
+    return (CARD16) (rand() & 0xFFFF);
+}
+
+static CARD32
+rand32(void)
+{
+    return ((CARD32) rand16() << 16) | rand16();
+}
+
+static void
+rand_bytes(unsigned char *buf, int size)
+{
+    int i;
+
+    for (i = 0; i < size; i++)
+	buf[i] = (unsigned char) rand();
+}
+
+/* writes n in the byte order of the message, for the decoder inputs */
+static void
+put16(unsigned char *p, CARD16 n, Bool swap)
+{
+    if (swap)
+	n = (CARD16) ((n << 8 & 0xFF00) | (n >> 8 & 0xFF));
+    memcpy(p, &n, 2);
+}
+
+static void
+dump(const char *name, const unsigned char *buf, int size)
+{
+    int i;
+
+    fprintf(stderr, "  %-8s %4d:", name, size);
+    for (i = 0; i < size && i < 64; i++)
+	fprintf(stderr, " %02x", buf[i]);
+    fprintf(stderr, size > 64 ? " ...\n" : "\n");
+}
+
+static void
+fail(const char *what)
+{
+    fprintf(stderr, "%s, %s byte order, iteration %d: %s\n",
+	    current_frame, current_swap ? "swapped" : "native",
+	    current_iteration, what);
+    failures++;
+}
+
+static void
+compare_bytes(int fm_size, int codec_size)
+{
+    if (fm_size == codec_size && memcmp(FM_BUF, CODEC_BUF, fm_size) == 0)
+	return;
+
+    fail("codec output differs from FrameMgr");
+    dump("FrameMgr", FM_BUF, fm_size);
+    dump("codec", CODEC_BUF, codec_size);
+}
+
+static void
+expect(Bool ok, const char *what)
+{
+    if (!ok)
+	fail(what);
+}
+
+/* the codec has to write every byte, padding included */
+static void
+clear_areas(void)
+{
+    memset(fm_area, 0, sizeof(fm_area));
+    memset(codec_area, 0xAA, sizeof(codec_area));
+}
+
+static void
+test_encode_forward_event(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id = rand16();
+    CARD16 icid = rand16();
+    CARD16 flag = rand16();
+    CARD16 serial = rand16();
+    int size;
+
+    clear_areas();
+    fm = FrameMgrInit(forward_event_fr, (char *) FM_BUF, swap);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    FrameMgrPutToken(fm, flag);
+    FrameMgrPutToken(fm, serial);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+
+    compare_bytes(size, _Xi18nEncodeForwardEvent(CODEC_BUF, swap,
+						 connect_id, icid,
+						 flag, serial));
+}
+
+static void
+test_decode_forward_event(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id, icid, flag, serial;
+    CARD16 c_connect_id, c_icid, c_flag, c_serial;
+    int size;
+
+    rand_bytes(FM_BUF, 8);
+    fm = FrameMgrInit(forward_event_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, connect_id);
+    FrameMgrGetToken(fm, icid);
+    FrameMgrGetToken(fm, flag);
+    FrameMgrGetToken(fm, serial);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+
+    expect(_Xi18nDecodeForwardEvent(FM_BUF, swap, &c_connect_id, &c_icid,
+				    &c_flag, &c_serial) == size,
+	   "size differs");
+    expect(connect_id == c_connect_id && icid == c_icid
+	   && flag == c_flag && serial == c_serial,
+	   "decoded fields differ");
+}
+
+static void
+test_encode_ext_forward_keyevent(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id = rand16();
+    CARD16 icid = rand16();
+    CARD16 flag = rand16();
+    CARD16 serial = rand16();
+    CARD8 type = (CARD8) rand();
+    CARD8 keycode = (CARD8) rand();
+    CARD16 state = rand16();
+    CARD32 time = rand32();
+    CARD32 window = rand32();
+    int size;
+
+    clear_areas();
+    fm = FrameMgrInit(ext_forward_keyevent_fr, (char *) FM_BUF, swap);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    FrameMgrPutToken(fm, flag);
+    FrameMgrPutToken(fm, serial);
+    FrameMgrPutToken(fm, type);
+    FrameMgrPutToken(fm, keycode);
+    FrameMgrPutToken(fm, state);
+    FrameMgrPutToken(fm, time);
+    FrameMgrPutToken(fm, window);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+
+    compare_bytes(size, _Xi18nEncodeExtForwardKeyEvent(CODEC_BUF, swap,
+						       connect_id, icid,
+						       flag, serial,
+						       type, keycode, state,
+						       time, window));
+}
+
+static void
+test_encode_commit_chars(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id = rand16();
+    CARD16 icid = rand16();
+    CARD16 flag = rand16();
+    CARD16 length = (CARD16) (rand() % MAX_STRING);
+    char string[MAX_STRING];
+    char *str = string;
+    int size;
+
+    rand_bytes((unsigned char *) string, length);
+
+    clear_areas();
+    fm = FrameMgrInit(commit_chars_fr, NULL, swap);
+    FrameMgrSetSize(fm, length);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrSetBuffer(fm, FM_BUF);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    FrameMgrPutToken(fm, flag);
+    FrameMgrPutToken(fm, length);
+    FrameMgrPutToken(fm, str);
+    FrameMgrFree(fm);
+
+    expect(_Xi18nCommitCharsSize(length) == size, "size differs");
+    compare_bytes(size, _Xi18nEncodeCommitChars(CODEC_BUF, swap,
+						connect_id, icid, flag,
+						str, length));
+}
+
+static void
+test_encode_preedit_draw(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id = rand16();
+    CARD16 icid = rand16();
+    CARD32 caret = rand32();
+    CARD32 chg_first = rand32();
+    CARD32 chg_length = rand32();
+    CARD32 status = rand32();
+    CARD16 length = (CARD16) (rand() % MAX_STRING);
+    int feedback_count = rand() % (length + 1);
+    char string[MAX_STRING];
+    char *str = string;
+    XIMFeedback feedback[MAX_STRING];
+    int size;
+    int i;
+
+    rand_bytes((unsigned char *) string, length);
+    for (i = 0; i < feedback_count; i++)
+	feedback[i] = rand32();
+
+    clear_areas();
+    fm = FrameMgrInit(preedit_draw_fr, NULL, swap);
+    FrameMgrSetSize(fm, length);
+    FrameMgrSetIterCount(fm, feedback_count);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrSetBuffer(fm, FM_BUF);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    FrameMgrPutToken(fm, caret);
+    FrameMgrPutToken(fm, chg_first);
+    FrameMgrPutToken(fm, chg_length);
+    FrameMgrPutToken(fm, status);
+    FrameMgrPutToken(fm, length);
+    FrameMgrPutToken(fm, str);
+    for (i = 0; i < feedback_count; i++)
+	FrameMgrPutToken(fm, feedback[i]);
+    FrameMgrFree(fm);
+
+    expect(_Xi18nPreeditDrawSize(length, feedback_count) == size,
+	   "size differs");
+    compare_bytes(size, _Xi18nEncodePreeditDraw(CODEC_BUF, swap,
+						connect_id, icid,
+						caret, chg_first, chg_length,
+						status, str, length,
+						feedback, feedback_count));
+}
+
+static void
+test_encode_ic_reply(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id = rand16();
+    CARD16 icid = rand16();
+    int size;
+
+    current_frame = "create_ic_reply_fr";
+    clear_areas();
+    fm = FrameMgrInit(create_ic_reply_fr, (char *) FM_BUF, swap);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+    compare_bytes(size, _Xi18nEncodeICReply(CODEC_BUF, swap,
+					    connect_id, icid));
+
+    current_frame = "set_ic_values_reply_fr";
+    clear_areas();
+    fm = FrameMgrInit(set_ic_values_reply_fr, (char *) FM_BUF, swap);
+    FrameMgrPutToken(fm, connect_id);
+    FrameMgrPutToken(fm, icid);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+    compare_bytes(size, _Xi18nEncodeICReply(CODEC_BUF, swap,
+					    connect_id, icid));
+}
+
+static void
+test_decode_sync_reply(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 connect_id, icid;
+    CARD16 c_connect_id, c_icid;
+    int size;
+
+    rand_bytes(FM_BUF, 4);
+    fm = FrameMgrInit(sync_reply_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, connect_id);
+    FrameMgrGetToken(fm, icid);
+    size = FrameMgrGetTotalSize(fm);
+    FrameMgrFree(fm);
+
+    expect(_Xi18nDecodeSyncReply(FM_BUF, swap,
+				 &c_connect_id, &c_icid) == size,
+	   "size differs");
+    expect(connect_id == c_connect_id && icid == c_icid,
+	   "decoded fields differ");
+}
+
+/*
+ * Writes a create_ic_fr or set_ic_values_fr message with random
+ * attributes and returns the offset of the first one. The message is
+ * made by hand, FrameMgr is only the reference for reading it.
+ */
+static int
+make_ic_message(Bool create, Bool swap)
+{
+    unsigned char *p;
+    int header = create ? 4 : 8;
+    int n_attrs = rand() % (MAX_ATTRS + 1);
+    int byte_length = 0;
+    int i;
+
+    memset(fm_area, 0, sizeof(fm_area));
+    rand_bytes(FM_BUF, header);
+    p = FM_BUF + header;
+    for (i = 0; i < n_attrs; i++) {
+	CARD16 value_length = (CARD16) (rand() % 40);
+	int size = 4 + value_length + (4 - value_length % 4) % 4;
+
+	put16(p, rand16(), swap);
+	put16(p + 2, value_length, swap);
+	rand_bytes(p + 4, value_length);
+	p += size;
+	byte_length += size;
+    }
+    put16(FM_BUF + (create ? 2 : 4), (CARD16) byte_length, swap);
+    return header;
+}
+
+static void
+test_decode_ic_attributes(Bool create, Bool swap)
+{
+    FrameMgr fm;
+    FmStatus status;
+    CARD16 connect_id, icid = 0, byte_length;
+    CARD16 c_connect_id, c_icid = 0, c_byte_length;
+    CARD16 ids[MAX_ATTRS];
+    CARD16 lengths[MAX_ATTRS];
+    unsigned char *values[MAX_ATTRS];
+    unsigned char *p;
+    int n_attrs = 0;
+    int header;
+    int offset;
+    int i;
+
+    header = make_ic_message(create, swap);
+
+    /* the way _Xi18nChangeIC() used to read it */
+    fm = FrameMgrInit(create ? create_ic_fr : set_ic_values_fr,
+		      (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, connect_id);
+    if (!create)
+	FrameMgrGetToken(fm, icid);
+    FrameMgrGetToken(fm, byte_length);
+    /* FrameMgr makes up one attribute out of an empty list, the codec
+       rightly does not, so the reference stops there */
+    while (byte_length > 0
+	   && FrameMgrIsIterLoopEnd(fm, &status) == False
+	   && n_attrs < MAX_ATTRS) {
+	int value_length;
+
+	FrameMgrGetToken(fm, ids[n_attrs]);
+	FrameMgrGetToken(fm, value_length);
+	FrameMgrSetSize(fm, value_length);
+	lengths[n_attrs] = value_length;
+	FrameMgrGetToken(fm, values[n_attrs]);
+	n_attrs++;
+    }
+    FrameMgrFree(fm);
+
+    if (create)
+	offset = _Xi18nDecodeCreateIC(FM_BUF, swap,
+				      &c_connect_id, &c_byte_length);
+    else
+	offset = _Xi18nDecodeSetICValues(FM_BUF, swap,
+					 &c_connect_id, &c_icid,
+					 &c_byte_length);
+    expect(offset == header, "header size differs");
+    expect(connect_id == c_connect_id && icid == c_icid
+	   && byte_length == c_byte_length,
+	   "decoded header fields differ");
+
+    p = FM_BUF + offset;
+    for (i = 0; p < FM_BUF + offset + c_byte_length; i++) {
+	CARD16 id, value_length;
+	unsigned char *value;
+
+	p += _Xi18nDecodeICAttribute(p, swap, &id, &value_length, &value);
+	if (i >= n_attrs) {
+	    fail("codec reads more attributes than FrameMgr");
+	    return;
+	}
+	expect(id == ids[i] && value_length == lengths[i],
+	       "decoded attribute differs");
+	expect(value_length == 0 || value == values[i],
+	       "attribute value is at a different offset");
+    }
+    expect(i == n_attrs, "codec reads fewer attributes than FrameMgr");
+    expect(p == FM_BUF + offset + c_byte_length,
+	   "attribute sizes do not add up to the byte length");
+}
+
+static void
+test_decode_values(Bool swap)
+{
+    FrameMgr fm;
+    CARD16 value16;
+    CARD32 value32;
+    CARD16 x, y, width, height;
+    XPoint point;
+    XRectangle rect;
+
+    rand_bytes(FM_BUF, 8);
+
+    current_frame = "short_fr";
+    fm = FrameMgrInit(short_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, value16);
+    FrameMgrFree(fm);
+    expect(_Xi18nDecodeCard16(FM_BUF, swap) == value16, "value differs");
+
+    current_frame = "long_fr";
+    fm = FrameMgrInit(long_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, value32);
+    FrameMgrFree(fm);
+    expect(_Xi18nDecodeCard32(FM_BUF, swap) == value32, "value differs");
+
+    current_frame = "xpoint_fr";
+    fm = FrameMgrInit(xpoint_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, x);
+    FrameMgrGetToken(fm, y);
+    FrameMgrFree(fm);
+    expect(_Xi18nDecodePoint(FM_BUF, swap, &point) == 4, "size differs");
+    expect(point.x == (short) x && point.y == (short) y, "point differs");
+
+    current_frame = "xrectangle_fr";
+    fm = FrameMgrInit(xrectangle_fr, (char *) FM_BUF, swap);
+    FrameMgrGetToken(fm, x);
+    FrameMgrGetToken(fm, y);
+    FrameMgrGetToken(fm, width);
+    FrameMgrGetToken(fm, height);
+    FrameMgrFree(fm);
+    expect(_Xi18nDecodeRectangle(FM_BUF, swap, &rect) == 8, "size differs");
+    expect(rect.x == (short) x && rect.y == (short) y
+	   && rect.width == width && rect.height == height,
+	   "rectangle differs");
+}
+
+int
+main(int argc, char *argv[])
+{
+    int swap;
+
+    srand(argc > 1 ? atoi(argv[1]) : 1);
+
+    for (swap = 0; swap <= 1; swap++) {
+	current_swap = swap;
+	for (current_iteration = 0; current_iteration < ITERATIONS;
+	     current_iteration++) {
+	    current_frame = "forward_event_fr";
+	    test_encode_forward_event(swap);
+	    test_decode_forward_event(swap);
+
+	    current_frame = "ext_forward_keyevent_fr";
+	    test_encode_ext_forward_keyevent(swap);
+
+	    current_frame = "commit_chars_fr";
+	    test_encode_commit_chars(swap);
+
+	    current_frame = "preedit_draw_fr";
+	    test_encode_preedit_draw(swap);
+
+	    test_encode_ic_reply(swap);
+
+	    current_frame = "sync_reply_fr";
+	    test_decode_sync_reply(swap);
+
+	    current_frame = "create_ic_fr";
+	    test_decode_ic_attributes(True, swap);
+
+	    current_frame = "set_ic_values_fr";
+	    test_decode_ic_attributes(False, swap);
+
+	    test_decode_values(swap);
+	}
+    }
+
+    if (failures > 0) {
+	fprintf(stderr, "codec: %d failures\n", failures);
+	return 1;
+    }
+
+    printf("codec: all frames agree with FrameMgr\n");
+    return 0;
+}
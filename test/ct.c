@@ -0,0 +1,287 @@
+/*
+ * Round trip test of the COMPOUND_TEXT codec in IMdkit/i18nCT.c against
+ * Xlib.
+ *
+ * Each string is encoded by IMUtf8ToCompoundText() and decoded by
+ * XmbTextPropertyToTextList(), and encoded by XmbTextListToTextProperty()
+ * and decoded by IMCompoundTextToUtf8(), in a UTF-8 locale. Both have to
+ * give back the string. In the second direction, strings which Xlib
+ * cannot put into COMPOUND_TEXT, or puts into a set which i18nCT.c does
+ * not decode, are left out. Outside a Korean locale Xlib takes GB2312 or
+ * JIS X 0208 for hanja, for one.
+ *
+ * The strings which are not left out have to come out of
+ * IMUtf8ToCompoundText() byte for byte as Xlib encodes them too, so
+ * that a client sees the same text from nabi as from Xlib.
+ *
+ * Needs an X display for the atoms, exits with 77 without one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include "IMdkit.h"
+
+#define ITERATIONS	2000
+#define MAX_CHARS	20
+
+static Display *display;
+static int failures = 0;
+static int skipped = 0;
+static int compared = 0;
+
+/* fixed cases, then random ones made of the ranges below */
+static const char *strings[] = {
+    "",
+    "hello, world",
+    "\xed\x95\x9c\xea\xb8\x80",				/* hangul syllables */
+    "\xe3\x84\xb1\xe3\x85\x8f",				/* compatibility jamo */
+    "\xe9\x9f\x93\xe5\x9c\x8b",				/* hanja */
+    "caf\xc3\xa9 \xc2\xa9",				/* latin-1 in GR */
+    "\xe2\x91\xa0\xe2\x98\x85",				/* KS X 1001 symbols */
+    "abc\xed\x95\x9c" "def\xea\xb8\x80" "g",		/* GL switches */
+    "\xed\x95\x9c \xc3\xa9 \xed\x95\x9c",		/* KSC5601 next to GR */
+    "\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab",		/* conjoining jamo */
+    "\xe2\x98\x83 \xed\x95\x9c\xea\xb8\x80",		/* UTF-8 segment */
+    "\xf0\x9f\x98\x80",					/* outside the BMP */
+};
+
+static const struct {
+    unsigned long first;
+    unsigned long last;
+} ranges[] = {
+    { 0x20, 0x7E },		/* ASCII */
+    { 0xA0, 0xFF },		/* Latin-1 */
+    { 0xAC00, 0xD7A3 },		/* hangul syllables */
+    { 0x3131, 0x318E },		/* compatibility jamo */
+    { 0x4E00, 0x9FFF },		/* CJK ideographs, hanja among them */
+    { 0x2460, 0x24FF },		/* enclosed alphanumerics */
+    { 0x2600, 0x26FF },		/* miscellaneous symbols */
+    { 0x1100, 0x11FF },		/* conjoining jamo */
+    { 0x1F600, 0x1F64F },	/* emoticons */
+};
+
+static int
+put_utf8(unsigned long ucs, char *p)
+{
+    if (ucs < 0x80) {
+	p[0] = (char) ucs;
+	return 1;
+    } else if (ucs < 0x800) {
+	p[0] = (char) (0xC0 | (ucs >> 6));
+	p[1] = (char) (0x80 | (ucs & 0x3F));
+	return 2;
+    } else if (ucs < 0x10000) {
+	p[0] = (char) (0xE0 | (ucs >> 12));
+	p[1] = (char) (0x80 | ((ucs >> 6) & 0x3F));
+	p[2] = (char) (0x80 | (ucs & 0x3F));
+	return 3;
+    }
+    p[0] = (char) (0xF0 | (ucs >> 18));
+    p[1] = (char) (0x80 | ((ucs >> 12) & 0x3F));
+    p[2] = (char) (0x80 | ((ucs >> 6) & 0x3F));
+    p[3] = (char) (0x80 | (ucs & 0x3F));
+    return 4;
+}
+
+static void
+random_string(char *buf)
+{
+    int n = 1 + rand() % MAX_CHARS;
+    int len = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+	int r = rand() % (sizeof(ranges) / sizeof(ranges[0]));
+	unsigned long ucs = ranges[r].first
+			    + rand() % (ranges[r].last - ranges[r].first + 1);
+
+	len += put_utf8(ucs, buf + len);
+    }
+    buf[len] = '\0';
+}
+
+static void
+dump(const char *name, const char *buf, int size)
+{
+    int i;
+
+    fprintf(stderr, "  %-8s %4d:", name, size);
+    for (i = 0; i < size && i < 64; i++)
+	fprintf(stderr, " %02x", (unsigned char) buf[i]);
+    fprintf(stderr, size > 64 ? " ...\n" : "\n");
+}
+
+static void
+fail(const char *what, const char *str, const char *ct, int ct_len)
+{
+    fprintf(stderr, "%s\n", what);
+    dump("string", str, strlen(str));
+    if (ct != NULL)
+	dump("ct", ct, ct_len);
+    failures++;
+}
+
+/* nabi encodes, Xlib decodes */
+static void
+test_to_xlib(const char *str)
+{
+    XTextProperty prop;
+    char **list = NULL;
+    int count = 0;
+    int len;
+    int ret;
+    char *ct;
+
+    len = IMUtf8ToCompoundText(str, -1, NULL, 0);
+    ct = malloc(len + 1);
+    if (IMUtf8ToCompoundText(str, -1, ct, len + 1) != len
+	|| (int) strlen(ct) != len) {
+	fail("IMUtf8ToCompoundText: length differs between calls",
+	     str, ct, len);
+	free(ct);
+	return;
+    }
+
+    prop.value = (unsigned char *) ct;
+    prop.encoding = XInternAtom(display, "COMPOUND_TEXT", False);
+    prop.format = 8;
+    prop.nitems = len;
+    ret = XmbTextPropertyToTextList(display, &prop, &list, &count);
+    if (ret != Success || count > 1 || (count == 0 && *str != '\0'))
+	fail("XmbTextPropertyToTextList cannot read IMUtf8ToCompoundText",
+	     str, ct, len);
+    else if (strcmp(count > 0 ? list[0] : "", str) != 0)
+	fail("IMUtf8ToCompoundText, XmbTextPropertyToTextList: "
+	     "no round trip", str, ct, len);
+
+    if (list != NULL)
+	XFreeStringList(list);
+    free(ct);
+}
+
+/* the designations IMCompoundTextToUtf8() knows */
+static const char *known_sets[] = {
+    "\033(B", "\033(J", "\033-A", "\033$(C", "\033$)C", "\033%G", "\033%@",
+};
+
+static Bool
+uses_known_sets(const char *ct, int len)
+{
+    int i, k;
+
+    for (i = 0; i < len; i++) {
+	if (ct[i] != '\033')
+	    continue;
+	for (k = 0; k < sizeof(known_sets) / sizeof(known_sets[0]); k++) {
+	    int n = strlen(known_sets[k]);
+
+	    if (i + n <= len && memcmp(ct + i, known_sets[k], n) == 0)
+		break;
+	}
+	if (k == sizeof(known_sets) / sizeof(known_sets[0]))
+	    return False;
+    }
+    return True;
+}
+
+/* Xlib encodes, nabi decodes */
+static void
+test_from_xlib(const char *str)
+{
+    XTextProperty prop;
+    char *list[1];
+    char *utf8;
+    char *ct;
+    int len;
+    int ret;
+
+    list[0] = (char *) str;
+    ret = XmbTextListToTextProperty(display, list, 1,
+				    XCompoundTextStyle, &prop);
+    if (ret != Success) {
+	/* Xlib cannot put some of it into COMPOUND_TEXT */
+	if (ret > 0)
+	    XFree(prop.value);
+	skipped++;
+	return;
+    }
+    if (!uses_known_sets((char *) prop.value, prop.nitems)) {
+	XFree(prop.value);
+	skipped++;
+	return;
+    }
+
+    len = IMCompoundTextToUtf8((char *) prop.value, prop.nitems, NULL, 0);
+    utf8 = malloc(len + 1);
+    IMCompoundTextToUtf8((char *) prop.value, prop.nitems, utf8, len + 1);
+    if (strcmp(utf8, str) != 0)
+	fail("XmbTextListToTextProperty, IMCompoundTextToUtf8: "
+	     "no round trip", str, (char *) prop.value, prop.nitems);
+    free(utf8);
+
+    /* the same bytes as Xlib */
+    len = IMUtf8ToCompoundText(str, -1, NULL, 0);
+    ct = malloc(len + 1);
+    IMUtf8ToCompoundText(str, -1, ct, len + 1);
+    if (len != prop.nitems || memcmp(ct, prop.value, len) != 0) {
+	fail("IMUtf8ToCompoundText: differs from XmbTextListToTextProperty",
+	     str, ct, len);
+	dump("xlib", (char *) prop.value, prop.nitems);
+    }
+    compared++;
+    free(ct);
+
+    XFree(prop.value);
+}
+
+int
+main(int argc, char *argv[])
+{
+    char buf[MAX_CHARS * 4 + 1];
+    int i;
+
+    if (setlocale(LC_CTYPE, "ko_KR.UTF-8") == NULL
+	&& setlocale(LC_CTYPE, "C.UTF-8") == NULL
+	&& setlocale(LC_CTYPE, "en_US.UTF-8") == NULL) {
+	fprintf(stderr, "ct: no UTF-8 locale, skipped\n");
+	return 77;
+    }
+    if (!XSupportsLocale()) {
+	fprintf(stderr, "ct: Xlib does not support %s, skipped\n",
+		setlocale(LC_CTYPE, NULL));
+	return 77;
+    }
+
+    display = XOpenDisplay(NULL);
+    if (display == NULL) {
+	fprintf(stderr, "ct: cannot open display, skipped\n");
+	return 77;
+    }
+
+    srand(argc > 1 ? atoi(argv[1]) : 1);
+
+    for (i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+	test_to_xlib(strings[i]);
+	test_from_xlib(strings[i]);
+    }
+
+    for (i = 0; i < ITERATIONS; i++) {
+	random_string(buf);
+	test_to_xlib(buf);
+	test_from_xlib(buf);
+    }
+
+    XCloseDisplay(display);
+
+    if (failures > 0) {
+	fprintf(stderr, "ct: %d failures\n", failures);
+	return 1;
+    }
+
+    printf("ct: all strings round trip, %d left out of the Xlib direction, "
+	   "%d encoded like Xlib\n", skipped, compared);
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * Benchmark of the COMPOUND_TEXT encoder in IMdkit/i18nCT.c against the
+ * Xlib path it replaced in src/ic.c, XmbTextListToTextProperty() in a
+ * UTF-8 locale, and of the decoder against XmbTextPropertyToTextList().
+ *
+ * The texts are the 2350 hangul syllables of KS X 1001, as a client
+ * gets them a syllable at a time on commit, and a mixed line with
+ * ASCII, Latin-1 and a UTF-8 segment. Prints the time per call and how
+ * many times faster i18nCT.c is.
+ *
+ * Needs an X display for the atoms, exits with 77 without one.
+ *
+ * usage: ctbench [ROUNDS]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <sys/time.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include "IMdkit.h"
+
+#define MAX_TEXTS	2400
+
+static Display *display;
+static Atom compound_text;
+static char *texts[MAX_TEXTS];
+static int n_texts;
+
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void
+add_text(const char *str)
+{
+    if (n_texts < MAX_TEXTS)
+	texts[n_texts++] = strdup(str);
+}
+
+/* every syllable which has a KS X 1001 code, as Xlib sees it */
+static void
+add_syllables(void)
+{
+    unsigned long ucs;
+    char buf[4];
+    char ct[16];
+
+    for (ucs = 0xAC00; ucs <= 0xD7A3; ucs++) {
+	buf[0] = (char) (0xE0 | (ucs >> 12));
+	buf[1] = (char) (0x80 | ((ucs >> 6) & 0x3F));
+	buf[2] = (char) (0x80 | (ucs & 0x3F));
+	buf[3] = '\0';
+	/* 4 bytes of designation and 2 of the code */
+	if (IMUtf8ToCompoundText(buf, 3, ct, sizeof(ct)) == 6)
+	    add_text(buf);
+    }
+}
+
+static void
+encode_nabi(const char *str)
+{
+    char buf[256];
+    char *ct;
+    int len;
+
+    /* as ic.c does: a stack buffer, the heap only when it does not fit */
+    len = IMUtf8ToCompoundText(str, -1, buf, sizeof(buf));
+    if (len >= sizeof(buf)) {
+	ct = malloc(len + 1);
+	IMUtf8ToCompoundText(str, -1, ct, len + 1);
+	free(ct);
+    }
+}
+
+static void
+encode_xlib(const char *str)
+{
+    XTextProperty prop;
+    char *list[1];
+
+    list[0] = (char *) str;
+    if (XmbTextListToTextProperty(display, list, 1,
+				  XCompoundTextStyle, &prop) >= Success)
+	XFree(prop.value);
+}
+
+static void
+decode_nabi(const char *ct, int len)
+{
+    char buf[256];
+    char *utf8;
+    int n;
+
+    n = IMCompoundTextToUtf8(ct, len, buf, sizeof(buf));
+    if (n >= sizeof(buf)) {
+	utf8 = malloc(n + 1);
+	IMCompoundTextToUtf8(ct, len, utf8, n + 1);
+	free(utf8);
+    }
+}
+
+static void
+decode_xlib(const char *ct, int len)
+{
+    XTextProperty prop;
+    char **list = NULL;
+    int count = 0;
+
+    prop.value = (unsigned char *) ct;
+    prop.encoding = compound_text;
+    prop.format = 8;
+    prop.nitems = len;
+    XmbTextPropertyToTextList(display, &prop, &list, &count);
+    if (list != NULL)
+	XFreeStringList(list);
+}
+
+/* seconds per call of encode over all the texts */
+static double
+time_encode(void (*encode)(const char *), int rounds)
+{
+    double start = now();
+    int r, i;
+
+    for (r = 0; r < rounds; r++)
+	for (i = 0; i < n_texts; i++)
+	    encode(texts[i]);
+    return (now() - start) / ((double) rounds * n_texts);
+}
+
+static double
+time_decode(void (*decode)(const char *, int), int rounds)
+{
+    char *ct[MAX_TEXTS];
+    int len[MAX_TEXTS];
+    double start, t;
+    int r, i;
+
+    for (i = 0; i < n_texts; i++) {
+	len[i] = IMUtf8ToCompoundText(texts[i], -1, NULL, 0);
+	ct[i] = malloc(len[i] + 1);
+	IMUtf8ToCompoundText(texts[i], -1, ct[i], len[i] + 1);
+    }
+
+    start = now();
+    for (r = 0; r < rounds; r++)
+	for (i = 0; i < n_texts; i++)
+	    decode(ct[i], len[i]);
+    t = (now() - start) / ((double) rounds * n_texts);
+
+    for (i = 0; i < n_texts; i++)
+	free(ct[i]);
+    return t;
+}
+
+static void
+report(const char *what, double nabi, double xlib)
+{
+    printf("%-28s nabi %8.0f ns, xlib %8.0f ns, %5.1f times faster\n",
+	   what, nabi * 1e9, xlib * 1e9, xlib / nabi);
+}
+
+static void
+run(const char *what, int rounds)
+{
+    char name[64];
+
+    snprintf(name, sizeof(name), "%s, encode", what);
+    report(name, time_encode(encode_nabi, rounds * 10),
+	   time_encode(encode_xlib, rounds));
+    snprintf(name, sizeof(name), "%s, decode", what);
+    report(name, time_decode(decode_nabi, rounds * 10),
+	   time_decode(decode_xlib, rounds));
+}
+
+static void
+free_texts(void)
+{
+    while (n_texts > 0)
+	free(texts[--n_texts]);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int rounds = argc > 1 ? atoi(argv[1]) : 20;
+
+    if (setlocale(LC_CTYPE, "ko_KR.UTF-8") == NULL
+	&& setlocale(LC_CTYPE, "C.UTF-8") == NULL
+	&& setlocale(LC_CTYPE, "en_US.UTF-8") == NULL) {
+	fprintf(stderr, "ctbench: no UTF-8 locale, skipped\n");
+	return 77;
+    }
+    if (!XSupportsLocale()) {
+	fprintf(stderr, "ctbench: Xlib does not support %s, skipped\n",
+		setlocale(LC_CTYPE, NULL));
+	return 77;
+    }
+
+    display = XOpenDisplay(NULL);
+    if (display == NULL) {
+	fprintf(stderr, "ctbench: cannot open display, skipped\n");
+	return 77;
+    }
+    compound_text = XInternAtom(display, "COMPOUND_TEXT", False);
+
+    printf("ctbench: %s, %d rounds\n", setlocale(LC_CTYPE, NULL), rounds);
+
+    add_syllables();
+    run("one syllable", rounds);
+    free_texts();
+
+    add_text("abc \xed\x95\x9c\xea\xb8\x80 caf\xc3\xa9 "
+	     "\xe2\x98\x83 \xed\x95\x9c\xea\xb5\xad\xec\x96\xb4 "
+	     "\xec\x9e\x85\xeb\xa0\xa5\xea\xb8\xb0");
+    run("mixed line", rounds * 500);
+    free_texts();
+
+    XCloseDisplay(display);
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Test of the call queue in src/queue.c, without X.
+ *
+ * The ring: calls run in the order they were pushed, a full queue
+ * refuses a push and leaves the data with the caller, and the ring
+ * keeps working after head and tail went round it many times.
+ *
+ * The wakeup: a thread pushes calls one at a time while the main
+ * thread sleeps in g_main_context_iteration(). Every call has to wake
+ * it up, a lost wakeup hangs the test until the alarm kills it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <glib.h>
+#include "queue.h"
+
+#define THREAD_CALLS	10000
+
+static int failures = 0;
+static int calls[64];
+static int n_calls;
+static volatile gint thread_calls;
+
+static void
+check(int cond, const char *what)
+{
+    if (!cond) {
+	fprintf(stderr, "queue: %s\n", what);
+	failures++;
+    }
+}
+
+static void
+record(gpointer data)
+{
+    if (n_calls < (int) G_N_ELEMENTS(calls))
+	calls[n_calls] = GPOINTER_TO_INT(data);
+    n_calls++;
+}
+
+/* runs what is in the queue without sleeping */
+static void
+run(GMainContext *context)
+{
+    n_calls = 0;
+    while (g_main_context_iteration(context, FALSE))
+	continue;
+}
+
+static void
+test_ring(void)
+{
+    GMainContext *context = g_main_context_new();
+    NabiQueue *queue;
+    int round, i;
+    int next = 0;
+    int ok;
+
+    /* 3 is rounded up to 4 */
+    queue = nabi_queue_new(3, context);
+    check(queue != NULL, "nabi_queue_new failed");
+
+    for (i = 0; i < 4; i++)
+	check(nabi_queue_push(queue, record, GINT_TO_POINTER(i)),
+	      "push into a queue with room failed");
+    check(!nabi_queue_push(queue, record, GINT_TO_POINTER(4)),
+	  "push into a full queue succeeded");
+
+    run(context);
+    check(n_calls == 4, "not all the calls of a full queue ran");
+    for (i = 0; i < 4 && i < n_calls; i++)
+	check(calls[i] == i, "calls ran out of order");
+
+    run(context);
+    check(n_calls == 0, "a call ran twice");
+
+    /* around the ring many times, a different number of calls each */
+    for (round = 0; round < 1000; round++) {
+	int n = 1 + round % 4;
+
+	for (i = 0; i < n; i++)
+	    check(nabi_queue_push(queue, record, GINT_TO_POINTER(next + i)),
+		  "push after wrapping around failed");
+	run(context);
+	ok = n_calls == n;
+	for (i = 0; ok && i < n; i++)
+	    ok = calls[i] == next + i;
+	check(ok, "calls lost or out of order after wrapping around");
+	next += n;
+    }
+
+    nabi_queue_free(queue);
+    g_main_context_unref(context);
+}
+
+static void
+count(gpointer data)
+{
+    g_atomic_int_inc(&thread_calls);
+}
+
+static gpointer
+pusher(gpointer data)
+{
+    NabiQueue *queue = (NabiQueue *) data;
+    int i;
+
+    for (i = 0; i < THREAD_CALLS; i++) {
+	/* every few calls wait until the consumer is likely asleep */
+	if (i % 100 == 0)
+	    g_usleep(100);
+	while (!nabi_queue_push(queue, count, NULL))
+	    g_usleep(10);
+    }
+
+    return NULL;
+}
+
+static void
+test_wakeup(void)
+{
+    GMainContext *context = g_main_context_new();
+    NabiQueue *queue;
+    GThread *thread;
+
+    queue = nabi_queue_new(16, context);
+    thread = g_thread_create(pusher, queue, TRUE, NULL);
+    check(thread != NULL, "can't create a thread");
+    if (thread == NULL)
+	return;
+
+    /* a lost wakeup leaves us asleep here */
+    alarm(20);
+    while (g_atomic_int_get(&thread_calls) < THREAD_CALLS)
+	g_main_context_iteration(context, TRUE);
+    alarm(0);
+
+    g_thread_join(thread);
+    check(thread_calls == THREAD_CALLS, "calls from the thread lost");
+
+    nabi_queue_free(queue);
+    g_main_context_unref(context);
+}
+
+int
+main(int argc, char *argv[])
+{
+    g_thread_init(NULL);
+
+    test_ring();
+    test_wakeup();
+
+    if (failures > 0) {
+	fprintf(stderr, "queue: %d failures\n", failures);
+	return 1;
+    }
+
+    printf("queue: ring and wakeup ok, %d calls from a thread\n",
+	   THREAD_CALLS);
+    return 0;
+}
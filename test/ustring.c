@@ -0,0 +1,156 @@
+/*
+ * Test of ustring_diff() in src/ustring.c, without X.
+ *
+ * ic.c sends the client only the span of the preedit string that
+ * changed, from the common prefix and suffix ustring_diff() finds. Each
+ * case gives the old and the new string and the feedback of their
+ * chars, u for underline and r for reverse like ic.c uses them, and
+ * the span expected. Then random pairs check that replacing the span
+ * of the old string with that of the new one gives the new string, and
+ * that the span is as short as it can be.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include "ustring.h"
+
+#define ITERATIONS	10000
+
+static int failures = 0;
+
+static const struct {
+    const char *old;
+    const char *old_attr;
+    const char *str;
+    const char *str_attr;
+    guint first;
+    guint last;
+} cases[] = {
+    { "",     "",     "",     "",     0, 0 },
+    { "",     "",     "a",    "r",    0, 0 },
+    { "a",    "r",    "",     "",     0, 0 },
+    { "abc",  "uur",  "abc",  "uur",  3, 0 },	/* nothing changed */
+    { "abc",  "uur",  "abd",  "uur",  2, 0 },	/* last char */
+    { "abc",  "uur",  "xbc",  "uur",  0, 2 },	/* first char */
+    { "abc",  "uur",  "abxc", "uuur", 2, 1 },	/* inserted */
+    { "abxc", "uuur", "abc",  "uur",  2, 1 },	/* deleted */
+    { "abc",  "uur",  "abc",  "uuu",  2, 0 },	/* feedback only */
+    { "aaa",  "uuu",  "aaaa", "uuuu", 3, 0 },	/* prefix and suffix */
+    { "aaaa", "uuuu", "aa",   "uu",   2, 0 },	/* never overlap */
+    { "abab", "uuuu", "ab",   "uu",   2, 0 },
+};
+
+static UString *
+make(const char *s)
+{
+    UString *str = ustring_new();
+
+    for (; *s != '\0'; s++) {
+	ucschar c = (unsigned char) *s;
+	ustring_append_ucs4(str, &c, 1);
+    }
+    return str;
+}
+
+static void
+test_case(int i)
+{
+    UString *old = make(cases[i].old);
+    UString *str = make(cases[i].str);
+    guint first = 99, last = 99;
+
+    ustring_diff(str, cases[i].str_attr, old, cases[i].old_attr, 1,
+		 &first, &last);
+    if (first != cases[i].first || last != cases[i].last) {
+	fprintf(stderr, "ustring: '%s' -> '%s': %u + %u, expected %u + %u\n",
+		cases[i].old, cases[i].str, first, last,
+		cases[i].first, cases[i].last);
+	failures++;
+    }
+
+    ustring_delete(old);
+    ustring_delete(str);
+}
+
+static void
+random_string(char *buf, int max)
+{
+    int n = rand() % (max + 1);
+    int i;
+
+    /* few letters, so that strings share prefixes and suffixes */
+    for (i = 0; i < n; i++)
+	buf[i] = "abc"[rand() % 3];
+    buf[n] = '\0';
+}
+
+static void
+test_random(void)
+{
+    char a[16], b[32], attr[32];
+    int i, k;
+
+    memset(attr, 'u', sizeof(attr));
+
+    for (i = 0; i < ITERATIONS; i++) {
+	UString *old, *str;
+	guint first, last;
+	guint len, old_len;
+	GString *patched;
+
+	random_string(a, 10);
+	/* mostly an edit of a, the way the preedit changes */
+	strcpy(b, a);
+	k = rand() % (strlen(b) + 1);
+	random_string(b + k, 4);
+	strcat(b, a + k + (k < (int) strlen(a) ? rand() % 2 : 0));
+
+	old = make(a);
+	str = make(b);
+	len = strlen(b);
+	old_len = strlen(a);
+	ustring_diff(str, attr, old, attr, 1, &first, &last);
+
+	patched = g_string_new(NULL);
+	g_string_append_len(patched, a, first);
+	g_string_append_len(patched, b + first, len - first - last);
+	g_string_append(patched, a + old_len - last);
+	if (first + last > len || first + last > old_len
+	    || strcmp(patched->str, b) != 0) {
+	    fprintf(stderr, "ustring: '%s' -> '%s': bad span %u + %u\n",
+		    a, b, first, last);
+	    failures++;
+	} else if ((first < len && first < old_len && a[first] == b[first])
+		   || (last < len - first && last < old_len - first
+		       && a[old_len - 1 - last] == b[len - 1 - last])) {
+	    fprintf(stderr, "ustring: '%s' -> '%s': span %u + %u too long\n",
+		    a, b, first, last);
+	    failures++;
+	}
+
+	g_string_free(patched, TRUE);
+	ustring_delete(old);
+	ustring_delete(str);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i;
+
+    srand(argc > 1 ? atoi(argv[1]) : 1);
+
+    for (i = 0; i < (int) G_N_ELEMENTS(cases); i++)
+	test_case(i);
+    test_random();
+
+    if (failures > 0) {
+	fprintf(stderr, "ustring: %d failures\n", failures);
+	return 1;
+    }
+
+    printf("ustring: diff spans ok\n");
+    return 0;
+}